@@ -0,0 +1,166 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "level_zero/core/source/cmdlist/barrier_elision.h"
+
+#include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/kernel/kernel_descriptor.h"
+
+#include "level_zero/core/source/kernel/kernel.h"
+
+namespace L0 {
+
+KernelMemoryAccesses KernelMemoryAccesses::fromKernel(const Kernel &kernel, bool isIndirect) {
+    KernelMemoryAccesses accesses;
+    //dispatch dimensions of indirect launches come from memory the command list does not track
+    accesses.unknown = isIndirect || kernel.hasIndirectAllocationsAllowed();
+
+    auto &explicitArgs = kernel.getImmutableData()->getDescriptor().payloadMappings.explicitArgs;
+    auto &residencyContainer = kernel.getResidencyContainer();
+    for (size_t i = 0; i < residencyContainer.size(); i++) {
+        auto allocation = residencyContainer[i];
+        if (allocation == nullptr) {
+            continue;
+        }
+        //implicit surfaces (private, globals, printf) follow arguments and are treated as written
+        bool readOnly = false;
+        if (i < explicitArgs.size()) {
+            auto &traits = explicitArgs[i].getTraits();
+            readOnly = traits.getAccessQualifier() == NEO::KernelArgMetadata::AccessReadOnly ||
+                       traits.getAddressQualifier() == NEO::KernelArgMetadata::AddrConstant ||
+                       traits.typeQualifiers.constQual;
+        }
+        if (readOnly) {
+            accesses.reads.push_back(allocation);
+        } else {
+            accesses.writes.push_back(allocation);
+        }
+    }
+    return accesses;
+}
+
+KernelMemoryAccesses KernelMemoryAccesses::fromAllocation(NEO::GraphicsAllocation *allocation, bool written) {
+    KernelMemoryAccesses accesses;
+    if (allocation == nullptr) {
+        accesses.unknown = true;
+    } else if (written) {
+        accesses.writes.push_back(allocation);
+    } else {
+        accesses.reads.push_back(allocation);
+    }
+    return accesses;
+}
+
+BarrierElisionTracker::Mode BarrierElisionTracker::getMode(bool relaxedOrdering) {
+    auto mode = NEO::DebugManager.flags.EnableBarrierElision.get();
+    if (mode != -1) {
+        return static_cast<Mode>(mode);
+    }
+    return relaxedOrdering ? Mode::Enabled : Mode::Disabled;
+}
+
+void BarrierElisionTracker::deferBarrier() {
+    if (barrierPending) {
+        //consecutive barriers order everything before the last one against what follows
+        accessesBeforeBarrier.add(accessesAfterBarrier);
+        accessesAfterBarrier.clear();
+        return;
+    }
+    barrierPending = true;
+    pendingBarrierElided = false;
+}
+
+bool BarrierElisionTracker::isBarrierRequiredBeforeKernel(const KernelMemoryAccesses &accesses) {
+    if (!barrierPending) {
+        accessesBeforeBarrier.add(accesses);
+        return false;
+    }
+
+    bool required = conflicts(accessesBeforeBarrier, accesses, true);
+    if (mode == Mode::Validation && !required && conflicts(accessesBeforeBarrier, accesses, false)) {
+        validationMismatchesCount++;
+        PRINT_DEBUG_STRING(NEO::DebugManager.flags.PrintDebugMessages.get(), stderr,
+                           "Barrier elision validation: kernel depends on memory accessed before an elided barrier\n");
+    }
+
+    if (required) {
+        barrierProgrammed();
+        accessesBeforeBarrier.add(accesses);
+        return true;
+    }
+
+    if (!pendingBarrierElided) {
+        pendingBarrierElided = true;
+        elidedBarriersCount++;
+    }
+    accessesAfterBarrier.add(accesses);
+    return false;
+}
+
+void BarrierElisionTracker::addAccesses(const KernelMemoryAccesses &accesses) {
+    //command is not reordered with the pending barrier, but kernels after next barrier still depend on it
+    if (barrierPending) {
+        accessesAfterBarrier.add(accesses);
+    } else {
+        accessesBeforeBarrier.add(accesses);
+    }
+}
+
+void BarrierElisionTracker::barrierProgrammed() {
+    //barrier waits for all previous work, so no earlier access can conflict any more
+    accessesBeforeBarrier.clear();
+    accessesAfterBarrier.clear();
+    barrierPending = false;
+    pendingBarrierElided = false;
+}
+
+void BarrierElisionTracker::reset() {
+    barrierProgrammed();
+    elidedBarriersCount = 0u;
+    validationMismatchesCount = 0u;
+}
+
+bool BarrierElisionTracker::conflicts(const AccessSet &previous, const KernelMemoryAccesses &accesses, bool readOnlyArgumentsTrusted) {
+    if (previous.unknown || accesses.unknown) {
+        return true;
+    }
+    for (auto allocation : accesses.writes) {
+        if (previous.writes.count(allocation) || previous.reads.count(allocation)) {
+            return true;
+        }
+    }
+    for (auto allocation : accesses.reads) {
+        if (previous.writes.count(allocation)) {
+            return true;
+        }
+        //baseline does not rely on argument qualifiers reported by the compiler
+        if (!readOnlyArgumentsTrusted && previous.reads.count(allocation)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void BarrierElisionTracker::AccessSet::add(const KernelMemoryAccesses &accesses) {
+    reads.insert(accesses.reads.begin(), accesses.reads.end());
+    writes.insert(accesses.writes.begin(), accesses.writes.end());
+    unknown |= accesses.unknown;
+}
+
+void BarrierElisionTracker::AccessSet::add(const AccessSet &accesses) {
+    reads.insert(accesses.reads.begin(), accesses.reads.end());
+    writes.insert(accesses.writes.begin(), accesses.writes.end());
+    unknown |= accesses.unknown;
+}
+
+void BarrierElisionTracker::AccessSet::clear() {
+    reads.clear();
+    writes.clear();
+    unknown = false;
+}
+
+} // namespace L0
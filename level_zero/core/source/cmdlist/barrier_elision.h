@@ -0,0 +1,78 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <unordered_set>
+#include <vector>
+
+namespace NEO {
+class GraphicsAllocation;
+} // namespace NEO
+
+namespace L0 {
+struct Kernel;
+
+//also describes commands other than kernels, e.g. post sync writes of events and timestamps
+struct KernelMemoryAccesses {
+    std::vector<NEO::GraphicsAllocation *> reads;
+    std::vector<NEO::GraphicsAllocation *> writes;
+    //kernel may access memory not known to the command list, e.g. through indirect allocations
+    bool unknown = false;
+
+    static KernelMemoryAccesses fromKernel(const Kernel &kernel, bool isIndirect);
+    static KernelMemoryAccesses fromAllocation(NEO::GraphicsAllocation *allocation, bool written);
+};
+
+class BarrierElisionTracker {
+  public:
+    enum class Mode : int32_t {
+        Disabled = 0,
+        Enabled = 1,
+        Validation = 2
+    };
+
+    static Mode getMode(bool relaxedOrdering);
+
+    BarrierElisionTracker(Mode mode) : mode(mode) {}
+
+    Mode getMode() const { return mode; }
+    bool isBarrierPending() const { return barrierPending; }
+    uint32_t getElidedBarriersCount() const { return elidedBarriersCount; }
+    uint32_t getValidationMismatchesCount() const { return validationMismatchesCount; }
+
+    void deferBarrier();
+    bool isBarrierRequiredBeforeKernel(const KernelMemoryAccesses &accesses);
+    void addAccesses(const KernelMemoryAccesses &accesses);
+    void barrierProgrammed();
+    void reset();
+
+  protected:
+    struct AccessSet {
+        std::unordered_set<NEO::GraphicsAllocation *> reads;
+        std::unordered_set<NEO::GraphicsAllocation *> writes;
+        bool unknown = false;
+
+        void add(const KernelMemoryAccesses &accesses);
+        void add(const AccessSet &accesses);
+        void clear();
+    };
+
+    static bool conflicts(const AccessSet &previous, const KernelMemoryAccesses &accesses, bool readOnlyArgumentsTrusted);
+
+    Mode mode;
+    //accesses of kernels ordered before the pending barrier and after it
+    AccessSet accessesBeforeBarrier;
+    AccessSet accessesAfterBarrier;
+    bool barrierPending = false;
+    bool pendingBarrierElided = false;
+    uint32_t elidedBarriersCount = 0u;
+    uint32_t validationMismatchesCount = 0u;
+};
+
+} // namespace L0
@@ -9,10 +9,18 @@
 
 #include "shared/source/command_stream/preemption.h"
 #include "shared/source/device/device_info.h"
+#include "shared/source/memory_manager/internal_allocation_storage.h"
 #include "shared/source/memory_manager/memory_manager.h"
 
+#include "level_zero/core/source/device/host_ptr_allocation_cache.h"
+
+#include <algorithm>
+#include <atomic>
+
 namespace L0 {
 
+static std::atomic<uint64_t> closedGenerationCounter{0u};
+
 CommandList::~CommandList() {
     if (cmdQImmediate) {
         cmdQImmediate->destroy();
@@ -21,6 +29,15 @@ CommandList::~CommandList() {
     removeHostPtrAllocations();
     printfFunctionContainer.clear();
 }
+
+void CommandList::markClosed() {
+    closedGeneration = ++closedGenerationCounter;
+}
+
+void CommandList::markOpen() {
+    closedGeneration = 0u;
+}
+
 void CommandList::storePrintfFunction(Kernel *kernel) {
     auto it = std::find(this->printfFunctionContainer.begin(), this->printfFunctionContainer.end(),
                         kernel);
@@ -32,8 +49,12 @@ void CommandList::storePrintfFunction(Kernel *kernel) {
 
 void CommandList::removeHostPtrAllocations() {
     auto memoryManager = device ? device->getNEODevice()->getMemoryManager() : nullptr;
+    auto hostPtrAllocationCache = device ? device->getHostPtrAllocationCache() : nullptr;
     for (auto &allocation : hostPtrMap) {
         UNRECOVERABLE_IF(memoryManager == nullptr);
+        if (hostPtrAllocationCache && hostPtrAllocationCache->release(allocation.second)) {
+            continue;
+        }
         memoryManager->freeGraphicsMemory(allocation.second);
     }
     hostPtrMap.clear();
@@ -61,7 +82,16 @@ NEO::GraphicsAllocation *CommandList::getHostPtrAlloc(const void *buffer, uint64
         *offset += ptrDiff(buffer, alloc->getUnderlyingBuffer());
         return alloc;
     }
-    alloc = device->allocateMemoryFromHostPtr(buffer, bufferSize);
+    auto hostPtrAllocationCache = device->getHostPtrAllocationCache();
+    if (hostPtrAllocationCache) {
+        alloc = hostPtrAllocationCache->acquire(buffer, bufferSize);
+        //shared allocation may start below buffer when it was registered for a larger range
+        if (alloc && alloc->getAllocationType() == NEO::GraphicsAllocation::AllocationType::EXTERNAL_HOST_PTR) {
+            *offset += ptrDiff(buffer, alloc->getUnderlyingBuffer());
+        }
+    } else {
+        alloc = device->allocateMemoryFromHostPtr(buffer, bufferSize);
+    }
     hostPtrMap.insert(std::make_pair(buffer, alloc));
     return alloc;
 }
@@ -85,6 +115,34 @@ void CommandList::removeDeallocationContainerData() {
     }
 }
 
+void CommandList::storeAllocationsForCompletion(NEO::InternalAllocationStorage &storage, uint32_t taskCount) {
+    auto &container = commandContainer.getDeallocationContainer();
+    for (auto it = container.begin(); it != container.end();) {
+        auto deallocation = *it;
+        if ((deallocation->getAllocationType() == NEO::GraphicsAllocation::AllocationType::INTERNAL_HEAP) ||
+            (deallocation->getAllocationType() == NEO::GraphicsAllocation::AllocationType::LINEAR_STREAM)) {
+            ++it;
+            continue;
+        }
+        NEO::SvmAllocationData *allocData = device->getDriverHandle()->getSvmAllocsManager()->getSVMAlloc(reinterpret_cast<void *>(deallocation->getGpuAddress()));
+        if (allocData) {
+            device->getDriverHandle()->getSvmAllocsManager()->removeSVMAlloc(*allocData);
+        }
+        storage.storeAllocationWithTaskCount(std::unique_ptr<NEO::GraphicsAllocation>(deallocation), NEO::TEMPORARY_ALLOCATION, taskCount);
+        it = container.erase(it);
+    }
+
+    auto hostPtrAllocationCache = device->getHostPtrAllocationCache();
+    for (auto &allocation : hostPtrMap) {
+        //shared allocations are kept by the cache, which defers their destruction until GPU is done with them
+        if (hostPtrAllocationCache && hostPtrAllocationCache->release(allocation.second)) {
+            continue;
+        }
+        storage.storeAllocationWithTaskCount(std::unique_ptr<NEO::GraphicsAllocation>(allocation.second), NEO::TEMPORARY_ALLOCATION, taskCount);
+    }
+    hostPtrMap.clear();
+}
+
 void CommandList::eraseDeallocationContainerEntry(NEO::GraphicsAllocation *allocation) {
     std::vector<NEO::GraphicsAllocation *>::iterator allocErase;
     auto container = &commandContainer.getDeallocationContainer();
@@ -105,10 +163,47 @@ void CommandList::eraseResidencyContainerEntry(NEO::GraphicsAllocation *allocati
     }
 }
 
+void CommandList::trackNonArgumentResidency() {
+    auto &residencyContainer = commandContainer.getResidencyContainer();
+    for (auto i = std::min(residencyTrackedCount, residencyContainer.size()); i < residencyContainer.size(); i++) {
+        nonArgumentResidency.insert(residencyContainer[i]);
+    }
+    residencyTrackedCount = residencyContainer.size();
+}
+
+void CommandList::removeStaleArgumentResidency(uint32_t launchIndex, const std::vector<NEO::GraphicsAllocation *> &newArgumentResidency) {
+    auto &residencyContainer = commandContainer.getResidencyContainer();
+    for (auto allocation : kernelLaunchPatchInfos[launchIndex].argumentResidency) {
+        if (std::find(newArgumentResidency.begin(), newArgumentResidency.end(), allocation) != newArgumentResidency.end() ||
+            nonArgumentResidency.find(allocation) != nonArgumentResidency.end()) {
+            continue;
+        }
+        bool usedByOtherLaunch = false;
+        for (uint32_t i = 0u; i < kernelLaunchPatchInfos.size() && !usedByOtherLaunch; i++) {
+            auto &otherResidency = kernelLaunchPatchInfos[i].argumentResidency;
+            usedByOtherLaunch = i != launchIndex && std::find(otherResidency.begin(), otherResidency.end(), allocation) != otherResidency.end();
+        }
+        if (!usedByOtherLaunch) {
+            residencyContainer.erase(std::remove(residencyContainer.begin(), residencyContainer.end(), allocation), residencyContainer.end());
+        }
+    }
+    residencyTrackedCount = std::min(residencyTrackedCount, residencyContainer.size());
+}
+
 bool CommandList::isCopyOnly() const {
     return NEO::EngineGroupType::Copy == engineGroupType;
 }
 
+void CommandList::initializeBarrierElision(bool relaxedOrdering) {
+    auto mode = BarrierElisionTracker::getMode(relaxedOrdering);
+    //immediate lists submit every command on its own and copy engines have no kernels to reorder
+    if (mode == BarrierElisionTracker::Mode::Disabled || cmdListType != CommandListType::TYPE_REGULAR || isCopyOnly()) {
+        barrierElisionTracker.reset();
+        return;
+    }
+    barrierElisionTracker = std::make_unique<BarrierElisionTracker>(mode);
+}
+
 NEO::PreemptionMode CommandList::obtainFunctionPreemptionMode(Kernel *kernel) {
     auto functionAttributes = kernel->getImmutableData()->getDescriptor().kernelAttributes;
     NEO::PreemptionFlags flags = {};
@@ -10,12 +10,15 @@
 #include "shared/source/command_container/cmdcontainer.h"
 #include "shared/source/command_stream/preemption_mode.h"
 
+#include "level_zero/core/source/cmdlist/barrier_elision.h"
 #include "level_zero/core/source/cmdqueue/cmdqueue.h"
 #include "level_zero/core/source/device/device.h"
 #include "level_zero/core/source/kernel/kernel.h"
 #include <level_zero/ze_api.h>
 #include <level_zero/zet_api.h>
 
+#include <memory>
+#include <unordered_set>
 #include <vector>
 
 struct _ze_command_list_handle_t {};
@@ -128,6 +131,8 @@ struct CommandList : _ze_command_list_handle_t {
     virtual ze_result_t appendMINoop() = 0;
     virtual ze_result_t appendPipeControl(void *dstPtr, uint64_t value) = 0;
 
+    virtual ze_result_t updateKernelLaunchArguments(uint32_t launchIndex, ze_kernel_handle_t hKernel) = 0;
+
     static CommandList *create(uint32_t productFamily, Device *device, NEO::EngineGroupType engineGroupType,
                                ze_result_t &resultValue);
     static CommandList *createImmediate(uint32_t productFamily, Device *device,
@@ -157,6 +162,25 @@ struct CommandList : _ze_command_list_handle_t {
         return indirectAllocationsAllowed;
     }
 
+    uint64_t getClosedGeneration() const {
+        return closedGeneration;
+    }
+
+    //residency appended by the command list itself, anything after it was added at execution
+    size_t getResidencyTrackedCount() const {
+        return residencyTrackedCount;
+    }
+
+    size_t getKernelLaunchesCount() const {
+        return kernelLaunchPatchInfos.size();
+    }
+
+    BarrierElisionTracker *getBarrierElisionTracker() const {
+        return barrierElisionTracker.get();
+    }
+
+    void initializeBarrierElision(bool relaxedOrdering);
+
     NEO::PreemptionMode obtainFunctionPreemptionMode(Kernel *kernel);
 
     std::vector<Kernel *> &getPrintfFunctionContainer() {
@@ -166,9 +190,14 @@ struct CommandList : _ze_command_list_handle_t {
     void storePrintfFunction(Kernel *kernel);
     void removeDeallocationContainerData();
     void removeHostPtrAllocations();
+    void storeAllocationsForCompletion(NEO::InternalAllocationStorage &storage, uint32_t taskCount);
     void eraseDeallocationContainerEntry(NEO::GraphicsAllocation *allocation);
     void eraseResidencyContainerEntry(NEO::GraphicsAllocation *allocation);
+    void trackNonArgumentResidency();
+    void removeStaleArgumentResidency(uint32_t launchIndex, const std::vector<NEO::GraphicsAllocation *> &newArgumentResidency);
     bool isCopyOnly() const;
+    void markClosed();
+    void markOpen();
 
     enum CommandListType : uint32_t {
         TYPE_REGULAR = 0u,
@@ -186,12 +215,35 @@ struct CommandList : _ze_command_list_handle_t {
     NEO::CommandContainer commandContainer;
 
   protected:
+    //location of payload encoded for a kernel launch, allows updating arguments without re-encoding the launch
+    struct KernelLaunchPatchInfo {
+        const NEO::KernelDescriptor *kernelDescriptor = nullptr;
+        NEO::GraphicsAllocation *crossThreadDataAllocation = nullptr;
+        size_t crossThreadDataOffset = 0u;
+        uint32_t crossThreadDataSize = 0u;
+        NEO::GraphicsAllocation *surfaceStateAllocation = nullptr;
+        size_t surfaceStateOffset = 0u;
+        uint32_t surfaceStateSize = 0u;
+        uint32_t groupCount[3] = {};
+        uint32_t groupSize[3] = {};
+        uint32_t slmTotalSize = 0u;
+        uint32_t numThreadsPerThreadGroup = 0u;
+        bool isIndirect = false;
+        std::vector<NEO::GraphicsAllocation *> argumentResidency;
+    };
+
     std::map<const void *, NEO::GraphicsAllocation *> hostPtrMap;
+    std::vector<KernelLaunchPatchInfo> kernelLaunchPatchInfos;
+    //residency added by anything else than kernel arguments, kept when arguments of a launch are updated
+    std::unordered_set<NEO::GraphicsAllocation *> nonArgumentResidency;
+    size_t residencyTrackedCount = 0u;
+    std::unique_ptr<BarrierElisionTracker> barrierElisionTracker;
     uint32_t commandListPerThreadScratchSize = 0u;
     NEO::PreemptionMode commandListPreemptionMode = NEO::PreemptionMode::Initial;
     NEO::EngineGroupType engineGroupType;
     UnifiedMemoryControls unifiedMemoryControls;
     bool indirectAllocationsAllowed = false;
+    uint64_t closedGeneration = 0u;
     NEO::GraphicsAllocation *getAllocationFromHostPtrMap(const void *buffer, uint64_t bufferSize);
     NEO::GraphicsAllocation *getHostPtrAlloc(const void *buffer, uint64_t bufferSize, size_t *offset);
 };
@@ -118,6 +118,8 @@ struct CommandListCoreFamily : CommandListImp {
     ze_result_t appendMINoop() override;
     ze_result_t appendPipeControl(void *dstPtr, uint64_t value) override;
 
+    ze_result_t updateKernelLaunchArguments(uint32_t launchIndex, ze_kernel_handle_t hKernel) override;
+
     ze_result_t appendQueryKernelTimestamps(uint32_t numEvents, ze_event_handle_t *phEvents, void *dstptr,
                                             const size_t *pOffsets, ze_event_handle_t hSignalEvent,
                                             uint32_t numWaitEvents, ze_event_handle_t *phWaitEvents) override;
@@ -202,6 +204,7 @@ struct CommandListCoreFamily : CommandListImp {
     void appendEventForProfiling(ze_event_handle_t hEvent, bool beforeWalker);
     void appendEventForProfilingCopyCommand(ze_event_handle_t hEvent, bool beforeWalker);
     void appendSignalEventPostWalker(ze_event_handle_t hEvent);
+    void appendPendingBarrier(const KernelMemoryAccesses &accesses);
     bool useMemCopyToBlitFill(size_t patternSize);
     void programStateBaseAddress(NEO::CommandContainer &container, bool genericMediaStateClearRequired);
 
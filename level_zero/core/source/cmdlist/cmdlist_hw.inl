@@ -7,6 +7,7 @@
 
 #include "shared/source/built_ins/built_ins.h"
 #include "shared/source/command_container/command_encoder.h"
+#include "shared/source/command_stream/command_stream_receiver.h"
 #include "shared/source/command_stream/linear_stream.h"
 #include "shared/source/command_stream/preemption.h"
 #include "shared/source/device/device.h"
@@ -20,9 +21,11 @@
 #include "shared/source/indirect_heap/indirect_heap.h"
 #include "shared/source/memory_manager/allocation_properties.h"
 #include "shared/source/memory_manager/graphics_allocation.h"
+#include "shared/source/memory_manager/internal_allocation_storage.h"
 #include "shared/source/memory_manager/memory_manager.h"
 
 #include "level_zero/core/source/cmdlist/cmdlist_hw.h"
+#include "level_zero/core/source/cmdqueue/cmdqueue_imp.h"
 #include "level_zero/core/source/device/device_imp.h"
 #include "level_zero/core/source/event/event.h"
 #include "level_zero/core/source/image/image.h"
@@ -71,10 +74,29 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::initialize(Device *device, NEO
 
 template <GFXCORE_FAMILY gfxCoreFamily>
 ze_result_t CommandListCoreFamily<gfxCoreFamily>::executeCommandListImmediate(bool performMigration) {
+    //printf output is printed by queue synchronization, kernels may be destroyed by application right after the append
+    bool hasPrintfOutput = !this->printfFunctionContainer.empty();
     this->close();
     ze_command_list_handle_t immediateHandle = this->toHandle();
-    this->cmdQImmediate->executeCommandLists(1, &immediateHandle, nullptr, performMigration);
-    this->cmdQImmediate->synchronize(std::numeric_limits<uint64_t>::max());
+    auto ret = this->cmdQImmediate->executeCommandLists(1, &immediateHandle, nullptr, performMigration);
+    if (ret != ZE_RESULT_SUCCESS) {
+        this->reset();
+        return ret;
+    }
+
+    auto cmdQImmediateImp = static_cast<CommandQueueImp *>(this->cmdQImmediate);
+    if (cmdQImmediateImp->getSynchronousMode() == ZE_COMMAND_QUEUE_MODE_ASYNCHRONOUS && !hasPrintfOutput) {
+        //do not wait for GPU, hand submitted buffers over to CSR and continue on fresh ones
+        auto csr = cmdQImmediateImp->getCsr();
+        auto internalAllocationStorage = csr->getInternalAllocationStorage();
+        auto taskCount = csr->peekTaskCount();
+
+        this->storeAllocationsForCompletion(*internalAllocationStorage, taskCount);
+        commandContainer.storeAllocationsForReuse(*internalAllocationStorage, taskCount);
+        internalAllocationStorage->cleanAllocationList(*csr->getTagAddress(), NEO::TEMPORARY_ALLOCATION);
+    } else {
+        this->cmdQImmediate->synchronize(std::numeric_limits<uint64_t>::max());
+    }
     this->reset();
 
     return ZE_RESULT_SUCCESS;
@@ -84,8 +106,14 @@ template <GFXCORE_FAMILY gfxCoreFamily>
 ze_result_t CommandListCoreFamily<gfxCoreFamily>::close() {
     using GfxFamily = typename NEO::GfxFamilyMapper<gfxCoreFamily>::GfxFamily;
 
+    appendPendingBarrier(KernelMemoryAccesses{});
+    if (cmdListType == CommandListType::TYPE_REGULAR) {
+        trackNonArgumentResidency();
+    }
     commandContainer.removeDuplicatesFromResidencyContainer();
+    residencyTrackedCount = commandContainer.getResidencyContainer().size();
     NEO::EncodeBatchBufferStartOrEnd<GfxFamily>::programBatchBufferEnd(commandContainer);
+    markClosed();
 
     return ZE_RESULT_SUCCESS;
 }
@@ -158,6 +186,9 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendLaunchMultipleKernelsInd
     const bool haveLaunchArguments = pLaunchArgumentsBuffer != nullptr;
     auto allocData = device->getDriverHandle()->getSvmAllocsManager()->getSVMAlloc(pNumLaunchArguments);
     auto alloc = allocData->gpuAllocations.getGraphicsAllocation(device->getRootDeviceIndex());
+
+    //number of launches is read by the command streamer before any of the kernels
+    appendPendingBarrier(KernelMemoryAccesses::fromAllocation(alloc, false));
     commandContainer.addToResidencyContainer(alloc);
 
     using GfxFamily = typename NEO::GfxFamilyMapper<gfxCoreFamily>::GfxFamily;
@@ -182,6 +213,8 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendEventReset(ze_event_hand
     using POST_SYNC_OPERATION = typename GfxFamily::PIPE_CONTROL::POST_SYNC_OPERATION;
     auto event = Event::fromHandle(hEvent);
 
+    appendPendingBarrier(KernelMemoryAccesses::fromAllocation(&event->getAllocation(), true));
+
     uint64_t baseAddr = event->getGpuAddress();
     size_t eventOffset = 0;
     if (event->isTimestampEvent) {
@@ -214,6 +247,18 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendBarrier(ze_event_handle_
         return ZE_RESULT_ERROR_INVALID_ARGUMENT;
     }
 
+    if (barrierElisionTracker) {
+        if (hSignalEvent == nullptr && numWaitEvents == 0u) {
+            //programmed only once a later kernel depends on memory used before the barrier
+            barrierElisionTracker->deferBarrier();
+            if (barrierElisionTracker->getMode() == BarrierElisionTracker::Mode::Enabled) {
+                return ZE_RESULT_SUCCESS;
+            }
+        } else {
+            barrierElisionTracker->barrierProgrammed();
+        }
+    }
+
     if (isCopyOnly()) {
         NEO::EncodeMiFlushDW<GfxFamily>::programMiFlushDw(*commandContainer.getCommandStream(), 0, 0, false, false);
     } else {
@@ -238,6 +283,7 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendMemoryRangesBarrier(uint
         return ZE_RESULT_ERROR_INVALID_ARGUMENT;
     }
 
+    appendPendingBarrier(KernelMemoryAccesses{});
     applyMemoryRangesBarrier(numRanges, pRangeSizes, pRanges);
 
     this->appendSignalEventPostWalker(hSignalEvent);
@@ -1228,12 +1274,30 @@ void CommandListCoreFamily<gfxCoreFamily>::appendSignalEventPostWalker(ze_event_
         return;
     }
     auto event = Event::fromHandle(hEvent);
+    //event completion implies completion of everything ordered before it by barriers
+    appendPendingBarrier(KernelMemoryAccesses::fromAllocation(&event->getAllocation(), true));
     if (event->isTimestampEvent) {
         appendEventForProfiling(hEvent, false);
     } else {
         CommandListCoreFamily<gfxCoreFamily>::appendSignalEvent(hEvent);
     }
 }
+template <GFXCORE_FAMILY gfxCoreFamily>
+void CommandListCoreFamily<gfxCoreFamily>::appendPendingBarrier(const KernelMemoryAccesses &accesses) {
+    if (barrierElisionTracker == nullptr) {
+        return;
+    }
+    if (barrierElisionTracker->isBarrierPending()) {
+        barrierElisionTracker->barrierProgrammed();
+        if (barrierElisionTracker->getMode() == BarrierElisionTracker::Mode::Enabled) {
+            NEO::PipeControlArgs args;
+            NEO::MemorySynchronizationCommands<GfxFamily>::addPipeControl(*commandContainer.getCommandStream(), args);
+        }
+    }
+    //kernels after a later barrier must still wait for memory written by this command
+    barrierElisionTracker->addAccesses(accesses);
+}
+
 template <GFXCORE_FAMILY gfxCoreFamily>
 void CommandListCoreFamily<gfxCoreFamily>::appendEventForProfilingCopyCommand(ze_event_handle_t hEvent, bool beforeWalker) {
     using GfxFamily = typename NEO::GfxFamilyMapper<gfxCoreFamily>::GfxFamily;
@@ -1331,6 +1395,7 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendSignalEvent(ze_event_han
     using GfxFamily = typename NEO::GfxFamilyMapper<gfxCoreFamily>::GfxFamily;
     auto event = Event::fromHandle(hEvent);
 
+    appendPendingBarrier(KernelMemoryAccesses::fromAllocation(&event->getAllocation(), true));
     commandContainer.addToResidencyContainer(&event->getAllocation());
     uint64_t baseAddr = event->getGpuAddress();
     size_t eventSignalOffset = 0;
@@ -1364,6 +1429,12 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendWaitOnEvents(uint32_t nu
     constexpr uint32_t eventStateClear = static_cast<uint32_t>(-1);
     bool dcFlushRequired = false;
 
+    KernelMemoryAccesses eventAccesses;
+    for (uint32_t i = 0; i < numEvents; i++) {
+        eventAccesses.reads.push_back(&Event::fromHandle(phEvent[i])->getAllocation());
+    }
+    appendPendingBarrier(eventAccesses);
+
     for (uint32_t i = 0; i < numEvents; i++) {
         auto event = Event::fromHandle(phEvent[i]);
         commandContainer.addToResidencyContainer(&event->getAllocation());
@@ -1409,6 +1480,10 @@ void CommandListCoreFamily<gfxCoreFamily>::appendEventForProfiling(ze_event_hand
         commandContainer.addToResidencyContainer(&event->getAllocation());
         auto baseAddr = event->getGpuAddress();
 
+        if (barrierElisionTracker) {
+            barrierElisionTracker->addAccesses(KernelMemoryAccesses::fromAllocation(&event->getAllocation(), true));
+        }
+
         if (beforeWalker) {
             auto contextStartAddr = baseAddr;
             auto globalStartAddr = baseAddr + offsetof(KernelTimestampEvent, globalStart);
@@ -1455,6 +1530,10 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendWriteGlobalTimestamp(
         }
     }
 
+    auto allocationStruct = getAlignedAllocation(this->device, dstptr, sizeof(uint64_t));
+    commandContainer.addToResidencyContainer(allocationStruct.alloc);
+    appendPendingBarrier(KernelMemoryAccesses::fromAllocation(allocationStruct.alloc, true));
+
     if (isCopyOnly()) {
         NEO::EncodeMiFlushDW<GfxFamily>::programMiFlushDw(*commandContainer.getCommandStream(),
                                                           reinterpret_cast<uint64_t>(dstptr),
@@ -1476,9 +1555,6 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendWriteGlobalTimestamp(
         CommandListCoreFamily<gfxCoreFamily>::appendSignalEvent(hSignalEvent);
     }
 
-    auto allocationStruct = getAlignedAllocation(this->device, dstptr, sizeof(uint64_t));
-    commandContainer.addToResidencyContainer(allocationStruct.alloc);
-
     return ZE_RESULT_SUCCESS;
 }
 
@@ -1501,11 +1577,15 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendQueryKernelTimestamps(
 
     std::unique_ptr<uint64_t[]> timestampsAddress = std::make_unique<uint64_t[]>(numEvents);
 
+    //events are read by the builtin through a table of addresses, so they are not among its arguments
+    KernelMemoryAccesses eventAccesses;
     for (uint32_t i = 0u; i < numEvents; ++i) {
         auto event = Event::fromHandle(phEvents[i]);
         commandContainer.addToResidencyContainer(&event->getAllocation());
         timestampsAddress[i] = event->getGpuAddress();
+        eventAccesses.reads.push_back(&event->getAllocation());
     }
+    appendPendingBarrier(eventAccesses);
 
     size_t alignedSize = alignUp<size_t>(sizeof(uint64_t) * numEvents, MemoryConstants::pageSize64k);
     NEO::GraphicsAllocation::AllocationType allocationType = NEO::GraphicsAllocation::AllocationType::BUFFER;
@@ -1593,7 +1673,14 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::reserveSpace(size_t size, void
 
 template <GFXCORE_FAMILY gfxCoreFamily>
 ze_result_t CommandListCoreFamily<gfxCoreFamily>::reset() {
+    markOpen();
     printfFunctionContainer.clear();
+    kernelLaunchPatchInfos.clear();
+    nonArgumentResidency.clear();
+    residencyTrackedCount = 0u;
+    if (barrierElisionTracker) {
+        barrierElisionTracker->reset();
+    }
     removeDeallocationContainerData();
     removeHostPtrAllocations();
     commandContainer.reset();
@@ -1605,6 +1692,96 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::reset() {
     return ZE_RESULT_SUCCESS;
 }
 
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamily<gfxCoreFamily>::updateKernelLaunchArguments(uint32_t launchIndex, ze_kernel_handle_t hKernel) {
+    using GfxFamily = typename NEO::GfxFamilyMapper<gfxCoreFamily>::GfxFamily;
+
+    if (launchIndex >= kernelLaunchPatchInfos.size()) {
+        return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+    //barriers were elided based on the recorded arguments, new ones might depend on each other
+    if (barrierElisionTracker && barrierElisionTracker->getElidedBarriersCount() > 0u) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+    auto kernel = Kernel::fromHandle(hKernel);
+    auto &patchInfo = kernelLaunchPatchInfos[launchIndex];
+    auto &kernelDescriptor = kernel->getImmutableData()->getDescriptor();
+
+    //commands, interface descriptor and per thread data stay as encoded, so only arguments may differ from the recorded launch
+    if (&kernelDescriptor != patchInfo.kernelDescriptor ||
+        kernel->getCrossThreadDataSize() != patchInfo.crossThreadDataSize ||
+        memcmp(kernel->getGroupSize(), patchInfo.groupSize, sizeof(patchInfo.groupSize)) != 0 ||
+        kernel->getSlmTotalSize() != patchInfo.slmTotalSize ||
+        kernel->getNumThreadsPerThreadGroup() != patchInfo.numThreadsPerThreadGroup) {
+        return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+
+    //payload is patched in place, so it must not be read by a submission still in flight
+    for (auto &engine : device->getNEODevice()->getMemoryManager()->getRegisteredEngines()) {
+        auto contextId = engine.osContext->getContextId();
+        if (patchInfo.crossThreadDataAllocation->isUsedByOsContext(contextId) &&
+            patchInfo.crossThreadDataAllocation->getTaskCount(contextId) > *engine.commandStreamReceiver->getTagAddress()) {
+            return ZE_RESULT_ERROR_NOT_AVAILABLE;
+        }
+    }
+
+    if (patchInfo.surfaceStateAllocation) {
+        //surface states reused by back-to-back launches can be changed only when all of them get the same ones
+        auto surfaceStates = ptrOffset(patchInfo.surfaceStateAllocation->getUnderlyingBuffer(), patchInfo.surfaceStateOffset);
+        if (memcmp(surfaceStates, kernel->getSurfaceStateHeapData(), patchInfo.surfaceStateSize) != 0) {
+            for (uint32_t i = 0u; i < kernelLaunchPatchInfos.size(); i++) {
+                if (i != launchIndex &&
+                    kernelLaunchPatchInfos[i].surfaceStateAllocation == patchInfo.surfaceStateAllocation &&
+                    kernelLaunchPatchInfos[i].surfaceStateOffset == patchInfo.surfaceStateOffset) {
+                    return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+                }
+            }
+        }
+    }
+
+    if (!patchInfo.isIndirect) {
+        kernel->setGroupCount(patchInfo.groupCount[0], patchInfo.groupCount[1], patchInfo.groupCount[2]);
+    }
+
+    auto crossThreadData = ptrOffset(patchInfo.crossThreadDataAllocation->getUnderlyingBuffer(), patchInfo.crossThreadDataOffset);
+    memcpy_s(crossThreadData, patchInfo.crossThreadDataSize, kernel->getCrossThreadData(), patchInfo.crossThreadDataSize);
+
+    if (patchInfo.surfaceStateAllocation) {
+        auto surfaceStates = ptrOffset(patchInfo.surfaceStateAllocation->getUnderlyingBuffer(), patchInfo.surfaceStateOffset);
+        memcpy_s(surfaceStates, patchInfo.surfaceStateSize, kernel->getSurfaceStateHeapData(), patchInfo.surfaceStateSize);
+        NEO::EncodeDispatchKernel<GfxFamily>::patchBindlessSurfaceStateOffsets(patchInfo.surfaceStateOffset, kernelDescriptor,
+                                                                              reinterpret_cast<uint8_t *>(crossThreadData));
+    }
+
+    if (closedGeneration != 0u) {
+        //internal allocations appended by queues at execution are not owned by the list and may be freed meanwhile
+        auto &residencyContainer = commandContainer.getResidencyContainer();
+        residencyContainer.resize(std::min(residencyTrackedCount, residencyContainer.size()));
+    }
+    //allocations of replaced arguments must not be kept resident on every execution of the list
+    trackNonArgumentResidency();
+    auto &argumentResidency = kernel->getResidencyContainer();
+    removeStaleArgumentResidency(launchIndex, argumentResidency);
+    patchInfo.argumentResidency = argumentResidency;
+    for (auto resource : argumentResidency) {
+        commandContainer.addToResidencyContainer(resource);
+    }
+    if (kernelDescriptor.kernelAttributes.flags.usesPrintf) {
+        storePrintfFunction(kernel);
+    }
+    //heap contents no longer match what the encoder remembers of the last dispatch
+    commandContainer.lastDispatchState.invalidate();
+
+    if (closedGeneration != 0u) {
+        //residency and payload changed, queues must not replay submissions recorded for previous contents
+        commandContainer.removeDuplicatesFromResidencyContainer();
+        markClosed();
+    }
+    residencyTrackedCount = commandContainer.getResidencyContainer().size();
+
+    return ZE_RESULT_SUCCESS;
+}
+
 template <GFXCORE_FAMILY gfxCoreFamily>
 ze_result_t CommandListCoreFamily<gfxCoreFamily>::prepareIndirectParams(const ze_group_count_t *pThreadGroupDimensions) {
     using GfxFamily = typename NEO::GfxFamilyMapper<gfxCoreFamily>::GfxFamily;
@@ -44,6 +44,15 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendLaunchKernelWithParams(z
     auto kernelPreemptionMode = obtainFunctionPreemptionMode(kernel);
     commandListPreemptionMode = std::min(commandListPreemptionMode, kernelPreemptionMode);
 
+    if (barrierElisionTracker) {
+        auto accesses = KernelMemoryAccesses::fromKernel(*kernel, isIndirect);
+        if (barrierElisionTracker->isBarrierRequiredBeforeKernel(accesses) &&
+            barrierElisionTracker->getMode() == BarrierElisionTracker::Mode::Enabled) {
+            NEO::PipeControlArgs args;
+            NEO::MemorySynchronizationCommands<GfxFamily>::addPipeControl(*commandContainer.getCommandStream(), args);
+        }
+    }
+
     if (!isIndirect) {
         kernel->setGroupCount(pThreadGroupDimensions->groupCountX,
                               pThreadGroupDimensions->groupCountY,
@@ -79,6 +88,31 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendLaunchKernelWithParams(z
                                                  device->getNEODevice(),
                                                  commandListPreemptionMode);
 
+    if (cmdListType == CommandListType::TYPE_REGULAR) {
+        KernelLaunchPatchInfo patchInfo;
+        patchInfo.kernelDescriptor = &functionImmutableData->getDescriptor();
+        auto ioh = commandContainer.getIndirectHeap(NEO::HeapType::INDIRECT_OBJECT);
+        patchInfo.crossThreadDataAllocation = ioh->getGraphicsAllocation();
+        patchInfo.crossThreadDataSize = kernel->getCrossThreadDataSize();
+        patchInfo.crossThreadDataOffset = ioh->getUsed() - kernel->getPerThreadDataSizeForWholeThreadGroup() - patchInfo.crossThreadDataSize;
+        if (patchInfo.kernelDescriptor->payloadMappings.bindingTable.numEntries > 0) {
+            //surface states may be shared with the previous launch, so take their location from the encoder
+            patchInfo.surfaceStateAllocation = commandContainer.lastDispatchState.surfaceStateHeapAllocation;
+            patchInfo.surfaceStateOffset = commandContainer.lastDispatchState.surfaceStateHeapOffset;
+            patchInfo.surfaceStateSize = patchInfo.kernelDescriptor->payloadMappings.bindingTable.tableOffset;
+        }
+        if (!isIndirect) {
+            patchInfo.groupCount[0] = pThreadGroupDimensions->groupCountX;
+            patchInfo.groupCount[1] = pThreadGroupDimensions->groupCountY;
+            patchInfo.groupCount[2] = pThreadGroupDimensions->groupCountZ;
+        }
+        memcpy_s(patchInfo.groupSize, sizeof(patchInfo.groupSize), kernel->getGroupSize(), sizeof(patchInfo.groupSize));
+        patchInfo.slmTotalSize = kernel->getSlmTotalSize();
+        patchInfo.numThreadsPerThreadGroup = kernel->getNumThreadsPerThreadGroup();
+        patchInfo.isIndirect = isIndirect;
+        kernelLaunchPatchInfos.push_back(patchInfo);
+    }
+
     if (device->getNEODevice()->getDebugger()) {
         auto *ssh = commandContainer.getIndirectHeap(NEO::HeapType::SURFACE_STATE);
         NEO::Device *neoDevice = device->getNEODevice();
@@ -95,9 +129,14 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendLaunchKernelWithParams(z
 
     commandContainer.addToResidencyContainer(functionImmutableData->getIsaGraphicsAllocation());
     auto &residencyContainer = kernel->getResidencyContainer();
+    if (cmdListType == CommandListType::TYPE_REGULAR) {
+        trackNonArgumentResidency();
+        kernelLaunchPatchInfos.back().argumentResidency = residencyContainer;
+    }
     for (auto resource : residencyContainer) {
         commandContainer.addToResidencyContainer(resource);
     }
+    residencyTrackedCount = commandContainer.getResidencyContainer().size();
 
     if (functionImmutableData->getDescriptor().kernelAttributes.flags.usesPrintf) {
         storePrintfFunction(kernel);
@@ -8,6 +8,9 @@
 #pragma once
 
 #include "level_zero/core/source/cmdlist/cmdlist_hw.h"
+#include "level_zero/core/source/cmdlist/split_memory_copy.h"
+
+#include <memory>
 
 namespace L0 {
 
@@ -21,6 +24,8 @@ struct CommandListCoreFamilyImmediate : public CommandListCoreFamily<gfxCoreFami
 
     using BaseClass::BaseClass;
 
+    ~CommandListCoreFamilyImmediate() override;
+
     ze_result_t appendLaunchKernel(ze_kernel_handle_t hKernel,
                                    const ze_group_count_t *pThreadGroupDimensions,
                                    ze_event_handle_t hEvent, uint32_t numWaitEvents,
@@ -85,6 +90,19 @@ struct CommandListCoreFamilyImmediate : public CommandListCoreFamily<gfxCoreFami
                                         ze_event_handle_t hEvent,
                                         uint32_t numWaitEvents,
                                         ze_event_handle_t *phWaitEvents) override;
+
+  protected:
+    size_t getSplitMemoryCopyEngineShare(void *dstptr, size_t size, ze_event_handle_t hSignalEvent);
+    ze_result_t appendMemoryCopySplit(void *dstptr,
+                                      const void *srcptr,
+                                      size_t size,
+                                      size_t copyEngineSize,
+                                      ze_event_handle_t hSignalEvent,
+                                      uint32_t numWaitEvents,
+                                      ze_event_handle_t *phWaitEvents);
+
+    std::unique_ptr<SplitMemoryCopy> splitMemoryCopy;
+    bool splitMemoryCopyUnavailable = false;
 };
 
 template <PRODUCT_FAMILY gfxProductFamily>
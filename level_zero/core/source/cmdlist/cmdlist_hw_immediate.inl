@@ -8,8 +8,20 @@
 #pragma once
 
 #include "level_zero/core/source/cmdlist/cmdlist_hw_immediate.h"
+#include "level_zero/core/source/cmdqueue/cmdqueue_imp.h"
+#include "level_zero/core/source/event/event.h"
+
+#include <limits>
 
 namespace L0 {
+template <GFXCORE_FAMILY gfxCoreFamily>
+CommandListCoreFamilyImmediate<gfxCoreFamily>::~CommandListCoreFamilyImmediate() {
+    if (splitMemoryCopy && this->cmdQImmediate) {
+        //compute side of a split copy waits on events owned by splitMemoryCopy
+        this->cmdQImmediate->synchronize(std::numeric_limits<uint64_t>::max());
+    }
+}
+
 template <GFXCORE_FAMILY gfxCoreFamily>
 ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendLaunchKernel(
     ze_kernel_handle_t hKernel, const ze_group_count_t *pThreadGroupDimensions,
@@ -57,6 +69,11 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendMemoryCopy(
     uint32_t numWaitEvents,
     ze_event_handle_t *phWaitEvents) {
 
+    auto copyEngineSize = getSplitMemoryCopyEngineShare(dstptr, size, hSignalEvent);
+    if (copyEngineSize != 0u) {
+        return appendMemoryCopySplit(dstptr, srcptr, size, copyEngineSize, hSignalEvent, numWaitEvents, phWaitEvents);
+    }
+
     auto ret = CommandListCoreFamily<gfxCoreFamily>::appendMemoryCopy(dstptr, srcptr, size, hSignalEvent,
                                                                       numWaitEvents, phWaitEvents);
     if (ret == ZE_RESULT_SUCCESS) {
@@ -64,6 +81,95 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendMemoryCopy(
     }
     return ret;
 }
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+size_t CommandListCoreFamilyImmediate<gfxCoreFamily>::getSplitMemoryCopyEngineShare(void *dstptr, size_t size, ze_event_handle_t hSignalEvent) {
+    if (!SplitMemoryCopy::isEnabled() || this->isCopyOnly() || size < SplitMemoryCopy::getMinSize()) {
+        return 0u;
+    }
+    //timestamps of a single event cannot describe work running on two engines
+    if (hSignalEvent && Event::fromHandle(hSignalEvent)->isTimestampEvent) {
+        return 0u;
+    }
+    if (!splitMemoryCopy && !splitMemoryCopyUnavailable) {
+        splitMemoryCopy.reset(SplitMemoryCopy::create(this->device));
+        splitMemoryCopyUnavailable = (splitMemoryCopy == nullptr);
+    }
+    if (!splitMemoryCopy) {
+        return 0u;
+    }
+
+    //compute part ends on a cacheline boundary of destination so neither part needs unaligned edges in the middle
+    auto computeSize = size - splitMemoryCopy->getBandwidthModel().getCopyEngineShare(size);
+    auto splitPtr = alignUp(ptrOffset(dstptr, computeSize), MemoryConstants::cacheLineSize);
+    computeSize = std::min(ptrDiff(splitPtr, dstptr), size);
+    return size - computeSize;
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendMemoryCopySplit(
+    void *dstptr,
+    const void *srcptr,
+    size_t size,
+    size_t copyEngineSize,
+    ze_event_handle_t hSignalEvent,
+    uint32_t numWaitEvents,
+    ze_event_handle_t *phWaitEvents) {
+
+    auto computeCsr = static_cast<CommandQueueImp *>(this->cmdQImmediate)->getCsr();
+    auto &slot = splitMemoryCopy->acquireSlot(*computeCsr);
+    auto computeSize = size - copyEngineSize;
+
+    //copy engine starts once compute side reaches the copy, so it observes the same dependencies
+    auto copyCommandList = static_cast<CommandListCoreFamily<gfxCoreFamily> *>(splitMemoryCopy->getCopyCommandList());
+    auto ret = copyCommandList->CommandListCoreFamily<gfxCoreFamily>::appendWaitOnEvents(1, &slot.forkEvent);
+    if (ret == ZE_RESULT_SUCCESS) {
+        ret = copyCommandList->CommandListCoreFamily<gfxCoreFamily>::appendMemoryCopy(ptrOffset(dstptr, computeSize), ptrOffset(srcptr, computeSize),
+                                                                                      copyEngineSize, nullptr, 0, nullptr);
+    }
+    if (ret == ZE_RESULT_SUCCESS) {
+        ret = copyCommandList->CommandListCoreFamily<gfxCoreFamily>::appendSignalEvent(slot.joinEvent);
+    }
+    if (ret == ZE_RESULT_SUCCESS) {
+        //failed submission resets the copy list, nothing waits for the fork yet
+        ret = copyCommandList->executeCommandListImmediate(true);
+    } else {
+        copyCommandList->reset();
+    }
+    if (ret != ZE_RESULT_SUCCESS) {
+        return ret;
+    }
+
+    if (numWaitEvents > 0) {
+        ret = CommandListCoreFamily<gfxCoreFamily>::appendWaitOnEvents(numWaitEvents, phWaitEvents);
+    }
+    if (ret == ZE_RESULT_SUCCESS) {
+        ret = CommandListCoreFamily<gfxCoreFamily>::appendSignalEvent(slot.forkEvent);
+    }
+    if (ret == ZE_RESULT_SUCCESS) {
+        ret = CommandListCoreFamily<gfxCoreFamily>::appendMemoryCopy(dstptr, srcptr, computeSize, nullptr, 0, nullptr);
+    }
+    if (ret == ZE_RESULT_SUCCESS) {
+        ret = CommandListCoreFamily<gfxCoreFamily>::appendWaitOnEvents(1, &slot.joinEvent);
+    }
+    if (ret == ZE_RESULT_SUCCESS && hSignalEvent) {
+        ret = CommandListCoreFamily<gfxCoreFamily>::appendSignalEvent(hSignalEvent);
+    }
+    if (ret == ZE_RESULT_SUCCESS) {
+        ret = executeCommandListImmediate(true);
+    } else {
+        this->reset();
+    }
+    if (ret != ZE_RESULT_SUCCESS) {
+        //copy engine is already waiting for the fork, release it so its queue does not hang
+        Event::fromHandle(slot.forkEvent)->hostSignal();
+        copyCommandList->cmdQImmediate->synchronize(std::numeric_limits<uint64_t>::max());
+        return ret;
+    }
+    splitMemoryCopy->releaseSlot(slot, computeCsr->peekTaskCount());
+
+    return ZE_RESULT_SUCCESS;
+}
 template <GFXCORE_FAMILY gfxCoreFamily>
 ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendMemoryCopyRegion(
     void *dstPtr,
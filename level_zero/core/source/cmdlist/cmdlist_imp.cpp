@@ -64,6 +64,8 @@ CommandList *CommandList::create(uint32_t productFamily, Device *device, NEO::En
         if (returnValue != ZE_RESULT_SUCCESS) {
             commandList->destroy();
             commandList = nullptr;
+        } else {
+            commandList->initializeBarrierElision(false);
         }
     }
     return commandList;
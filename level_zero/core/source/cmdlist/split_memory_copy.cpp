@@ -0,0 +1,141 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "level_zero/core/source/cmdlist/split_memory_copy.h"
+
+#include "shared/source/command_stream/command_stream_receiver.h"
+#include "shared/source/command_stream/csr_definitions.h"
+#include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/device/device.h"
+
+#include "level_zero/core/source/cmdlist/cmdlist.h"
+#include "level_zero/core/source/cmdqueue/cmdqueue.h"
+#include "level_zero/core/source/device/device.h"
+#include "level_zero/core/source/event/event.h"
+
+#include <algorithm>
+#include <limits>
+
+namespace L0 {
+
+SplitMemoryCopyBandwidthModel SplitMemoryCopyBandwidthModel::create() {
+    SplitMemoryCopyBandwidthModel model;
+    if (NEO::DebugManager.flags.SplitMemoryCopyCopyEngineBandwidth.get() > 0) {
+        model.copyEngineBandwidth = static_cast<double>(NEO::DebugManager.flags.SplitMemoryCopyCopyEngineBandwidth.get());
+    }
+    if (NEO::DebugManager.flags.SplitMemoryCopyComputeBandwidth.get() > 0) {
+        model.computeBandwidth = static_cast<double>(NEO::DebugManager.flags.SplitMemoryCopyComputeBandwidth.get());
+    }
+    return model;
+}
+
+size_t SplitMemoryCopyBandwidthModel::getCopyEngineShare(size_t size) const {
+    //choose the copy engine part so that both engines are expected to finish at the same time
+    auto totalBandwidth = copyEngineBandwidth + computeBandwidth;
+    auto share = (copyEngineBandwidth * computeBandwidth * (computeLatency - copyEngineLatency) +
+                  static_cast<double>(size) * copyEngineBandwidth) /
+                 totalBandwidth;
+    share = std::max(share, 0.0);
+    share = std::min(share, static_cast<double>(size));
+    return static_cast<size_t>(share);
+}
+
+bool SplitMemoryCopy::isEnabled() {
+    return NEO::DebugManager.flags.EnableSplitMemoryCopy.get() == 1;
+}
+
+size_t SplitMemoryCopy::getMinSize() {
+    if (NEO::DebugManager.flags.SplitMemoryCopyMinSize.get() != -1) {
+        return static_cast<size_t>(NEO::DebugManager.flags.SplitMemoryCopyMinSize.get());
+    }
+    return defaultMinSize;
+}
+
+SplitMemoryCopy *SplitMemoryCopy::create(Device *device) {
+    NEO::Device *neoDevice = device->getNEODevice();
+    if (neoDevice->getNumAvailableDevices() > 1) {
+        neoDevice = neoDevice->getDeviceById(0);
+    }
+    auto &engineGroups = neoDevice->getEngineGroups();
+    auto copyGroupIndex = static_cast<uint32_t>(NEO::EngineGroupType::Copy);
+    if (engineGroups.size() <= copyGroupIndex || engineGroups[copyGroupIndex].empty()) {
+        return nullptr;
+    }
+
+    ze_command_queue_desc_t copyQueueDesc = {};
+    copyQueueDesc.stype = ZE_STRUCTURE_TYPE_COMMAND_QUEUE_DESC;
+    copyQueueDesc.mode = ZE_COMMAND_QUEUE_MODE_ASYNCHRONOUS;
+    for (uint32_t i = 0; i < copyGroupIndex; i++) {
+        if (!engineGroups[i].empty()) {
+            copyQueueDesc.ordinal++;
+        }
+    }
+
+    ze_result_t returnValue = ZE_RESULT_SUCCESS;
+    auto copyCommandList = CommandList::createImmediate(neoDevice->getHardwareInfo().platform.eProductFamily, device, &copyQueueDesc,
+                                                        false, NEO::EngineGroupType::Copy, returnValue);
+    if (copyCommandList == nullptr) {
+        return nullptr;
+    }
+
+    auto splitMemoryCopy = new SplitMemoryCopy();
+    splitMemoryCopy->copyCommandList = copyCommandList;
+    splitMemoryCopy->bandwidthModel = SplitMemoryCopyBandwidthModel::create();
+
+    ze_event_pool_desc_t eventPoolDesc = {};
+    eventPoolDesc.stype = ZE_STRUCTURE_TYPE_EVENT_POOL_DESC;
+    eventPoolDesc.flags = ZE_EVENT_POOL_FLAG_HOST_VISIBLE;
+    eventPoolDesc.count = 2 * slotsCount;
+    ze_device_handle_t hDevice = device->toHandle();
+    splitMemoryCopy->eventPool = EventPool::create(device->getDriverHandle(), 1, &hDevice, &eventPoolDesc);
+
+    ze_event_desc_t eventDesc = {};
+    eventDesc.stype = ZE_STRUCTURE_TYPE_EVENT_DESC;
+    eventDesc.signal = ZE_EVENT_SCOPE_FLAG_HOST;
+    eventDesc.wait = ZE_EVENT_SCOPE_FLAG_HOST;
+    splitMemoryCopy->slots.resize(slotsCount);
+    for (auto &slot : splitMemoryCopy->slots) {
+        splitMemoryCopy->eventPool->createEvent(&eventDesc, &slot.forkEvent);
+        eventDesc.index++;
+        splitMemoryCopy->eventPool->createEvent(&eventDesc, &slot.joinEvent);
+        eventDesc.index++;
+    }
+
+    return splitMemoryCopy;
+}
+
+SplitMemoryCopy::~SplitMemoryCopy() {
+    if (copyCommandList->cmdQImmediate) {
+        copyCommandList->cmdQImmediate->synchronize(std::numeric_limits<uint64_t>::max());
+    }
+    for (auto &slot : slots) {
+        Event::fromHandle(slot.forkEvent)->destroy();
+        Event::fromHandle(slot.joinEvent)->destroy();
+    }
+    eventPool->destroy();
+    copyCommandList->destroy();
+}
+
+SplitMemoryCopy::Slot &SplitMemoryCopy::acquireSlot(NEO::CommandStreamReceiver &computeCsr) {
+    auto slotIndex = nextSlot;
+    auto &slot = slots[slotIndex];
+    nextSlot = (nextSlot + 1) % slotsCount;
+
+    //events of a slot may be reset only after compute side consumed the join, which implies copy engine consumed the fork
+    if (*computeCsr.getTagAddress() < slot.taskCount) {
+        computeCsr.waitForCompletionWithTimeout(false, NEO::TimeoutControls::maxTimeout, slot.taskCount);
+    }
+    //fork and join events of a slot are adjacent in the pool
+    eventPool->resetEvents(2 * slotIndex, 2u);
+    return slot;
+}
+
+void SplitMemoryCopy::releaseSlot(Slot &slot, uint32_t taskCount) {
+    slot.taskCount = taskCount;
+}
+
+} // namespace L0
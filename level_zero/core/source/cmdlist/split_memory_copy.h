@@ -0,0 +1,68 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <level_zero/ze_api.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace NEO {
+class CommandStreamReceiver;
+} // namespace NEO
+
+namespace L0 {
+struct CommandList;
+struct Device;
+struct EventPool;
+
+struct SplitMemoryCopyBandwidthModel {
+    //bytes per microsecond and fixed submission cost in microseconds of each engine
+    double copyEngineBandwidth = 12000.0;
+    double copyEngineLatency = 15.0;
+    double computeBandwidth = 20000.0;
+    double computeLatency = 25.0;
+
+    static SplitMemoryCopyBandwidthModel create();
+    size_t getCopyEngineShare(size_t size) const;
+};
+
+class SplitMemoryCopy {
+  public:
+    static constexpr size_t defaultMinSize = 64 * 1024 * 1024;
+    static constexpr uint32_t slotsCount = 4u;
+
+    struct Slot {
+        ze_event_handle_t forkEvent = nullptr;
+        ze_event_handle_t joinEvent = nullptr;
+        uint32_t taskCount = 0u;
+    };
+
+    static bool isEnabled();
+    static size_t getMinSize();
+    static SplitMemoryCopy *create(Device *device);
+    ~SplitMemoryCopy();
+
+    Slot &acquireSlot(NEO::CommandStreamReceiver &computeCsr);
+    void releaseSlot(Slot &slot, uint32_t taskCount);
+
+    CommandList *getCopyCommandList() const { return copyCommandList; }
+    const SplitMemoryCopyBandwidthModel &getBandwidthModel() const { return bandwidthModel; }
+
+  protected:
+    SplitMemoryCopy() = default;
+
+    CommandList *copyCommandList = nullptr;
+    EventPool *eventPool = nullptr;
+    std::vector<Slot> slots;
+    uint32_t nextSlot = 0u;
+    SplitMemoryCopyBandwidthModel bandwidthModel;
+};
+
+} // namespace L0
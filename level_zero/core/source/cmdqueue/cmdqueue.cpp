@@ -19,6 +19,8 @@
 #include "hw_helpers.h"
 #include "igfxfmid.h"
 
+#include <algorithm>
+
 namespace L0 {
 
 CommandQueueAllocatorFn commandQueueFactory[IGFX_MAX_PRODUCT] = {};
@@ -57,7 +59,7 @@ void CommandQueueImp::submitBatchBuffer(size_t offset, NEO::ResidencyContainer &
                                  commandStream->getUsed(), commandStream, endingCmdPtr);
 
     csr->submitBatchBuffer(batchBuffer, residencyContainer);
-    buffers.setCurrentFlushStamp(csr->obtainCurrentFlushStamp());
+    buffers.setCurrentFlushStamp(csr->obtainCurrentFlushStamp(), csr->peekTaskCount());
 }
 
 ze_result_t CommandQueueImp::synchronize(uint64_t timeout) {
@@ -118,44 +120,106 @@ ze_command_queue_mode_t CommandQueueImp::getSynchronousMode() {
     return desc.mode;
 }
 
+bool CommandQueueImp::SubmissionReplay::isRecordable(uint32_t numCommandLists, ze_command_list_handle_t *phCommandLists) {
+    if (!NEO::DebugManager.flags.EnableCommandQueueSubmissionReplay.get()) {
+        return false;
+    }
+    for (auto i = 0u; i < numCommandLists; i++) {
+        auto commandList = CommandList::fromHandle(phCommandLists[i]);
+        //internal allocations reachable indirectly change between executions, so their residency cannot be cached
+        if (commandList->cmdListType != CommandList::CommandListType::TYPE_REGULAR ||
+            commandList->getClosedGeneration() == 0u ||
+            commandList->hasIndirectAllocationsAllowed()) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool CommandQueueImp::SubmissionReplay::matches(uint32_t numCommandLists, ze_command_list_handle_t *phCommandLists) const {
+    if (!valid || numCommandLists != commandLists.size()) {
+        return false;
+    }
+    for (auto i = 0u; i < numCommandLists; i++) {
+        if (commandLists[i] != phCommandLists[i] ||
+            closedGenerations[i] != CommandList::fromHandle(phCommandLists[i])->getClosedGeneration()) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void CommandQueueImp::SubmissionReplay::record(uint32_t numCommandLists, ze_command_list_handle_t *phCommandLists) {
+    commandLists.assign(phCommandLists, phCommandLists + numCommandLists);
+    closedGenerations.resize(numCommandLists);
+    for (auto i = 0u; i < numCommandLists; i++) {
+        closedGenerations[i] = CommandList::fromHandle(phCommandLists[i])->getClosedGeneration();
+    }
+    valid = true;
+}
+
 void CommandQueueImp::CommandBufferManager::initialize(Device *device, size_t sizeRequested) {
-    size_t alignedSize = alignUp<size_t>(sizeRequested, MemoryConstants::pageSize64k);
-    NEO::AllocationProperties properties{device->getRootDeviceIndex(), true, alignedSize,
+    this->device = device;
+    this->bufferSize = alignUp<size_t>(sizeRequested, MemoryConstants::pageSize64k);
+
+    if (NEO::DebugManager.flags.L0CommandQueueMaxCommandBuffers.get() != -1) {
+        maxBuffersCount = std::max(initialBuffersCount, static_cast<uint32_t>(NEO::DebugManager.flags.L0CommandQueueMaxCommandBuffers.get()));
+    }
+
+    buffers.reserve(maxBuffersCount);
+    for (uint32_t i = 0; i < initialBuffersCount; i++) {
+        buffers.push_back(allocateBuffer());
+    }
+    bufferUse = 0u;
+}
+
+CommandQueueImp::CommandBufferManager::CommandBuffer CommandQueueImp::CommandBufferManager::allocateBuffer() {
+    NEO::AllocationProperties properties{device->getRootDeviceIndex(), true, bufferSize,
                                          NEO::GraphicsAllocation::AllocationType::COMMAND_BUFFER,
                                          device->isMultiDeviceCapable(),
                                          false,
                                          CommonConstants::allDevicesBitfield};
 
-    buffers[BUFFER_ALLOCATION::FIRST] = device->getNEODevice()->getMemoryManager()->allocateGraphicsMemoryWithProperties(properties);
-
-    UNRECOVERABLE_IF(nullptr == buffers[BUFFER_ALLOCATION::FIRST]);
-    memset(buffers[BUFFER_ALLOCATION::FIRST]->getUnderlyingBuffer(), 0, buffers[BUFFER_ALLOCATION::FIRST]->getUnderlyingBufferSize());
-
-    buffers[BUFFER_ALLOCATION::SECOND] = device->getNEODevice()->getMemoryManager()->allocateGraphicsMemoryWithProperties(properties);
+    CommandBuffer buffer;
+    buffer.allocation = device->getNEODevice()->getMemoryManager()->allocateGraphicsMemoryWithProperties(properties);
 
-    UNRECOVERABLE_IF(nullptr == buffers[BUFFER_ALLOCATION::SECOND]);
-    memset(buffers[BUFFER_ALLOCATION::SECOND]->getUnderlyingBuffer(), 0, buffers[BUFFER_ALLOCATION::SECOND]->getUnderlyingBufferSize());
-    flushId[BUFFER_ALLOCATION::FIRST] = 0u;
-    flushId[BUFFER_ALLOCATION::SECOND] = 0u;
+    UNRECOVERABLE_IF(nullptr == buffer.allocation);
+    memset(buffer.allocation->getUnderlyingBuffer(), 0, buffer.allocation->getUnderlyingBufferSize());
+    return buffer;
 }
 
 void CommandQueueImp::CommandBufferManager::destroy(NEO::MemoryManager *memoryManager) {
-    memoryManager->freeGraphicsMemory(buffers[BUFFER_ALLOCATION::FIRST]);
-    memoryManager->freeGraphicsMemory(buffers[BUFFER_ALLOCATION::SECOND]);
+    for (auto &buffer : buffers) {
+        memoryManager->freeGraphicsMemory(buffer.allocation);
+    }
+    buffers.clear();
 }
 
 void CommandQueueImp::CommandBufferManager::switchBuffers(NEO::CommandStreamReceiver *csr) {
-    if (bufferUse == BUFFER_ALLOCATION::FIRST) {
-        bufferUse = BUFFER_ALLOCATION::SECOND;
-    } else {
-        bufferUse = BUFFER_ALLOCATION::FIRST;
+    UNRECOVERABLE_IF(csr == nullptr);
+
+    //buffers are kept in submission order, so the next one in the ring is the oldest
+    auto nextBuffer = (bufferUse + 1) % buffers.size();
+    auto completedTaskCount = *csr->getTagAddress();
+
+    if (buffers[nextBuffer].taskCount <= completedTaskCount) {
+        bufferUse = nextBuffer;
+        return;
+    }
+
+    if (buffers.size() < maxBuffersCount) {
+        bufferUse = bufferUse + 1;
+        buffers.insert(buffers.begin() + bufferUse, allocateBuffer());
+        return;
     }
 
-    NEO::FlushStamp completionId = flushId[bufferUse];
-    if (completionId != 0u) {
-        UNRECOVERABLE_IF(csr == nullptr);
-        csr->waitForFlushStamp(completionId);
+    stallCount++;
+    bufferUse = nextBuffer;
+    auto &buffer = buffers[bufferUse];
+    if (buffer.flushStamp != 0u) {
+        csr->waitForFlushStamp(buffer.flushStamp);
     }
+    csr->waitForCompletionWithTimeout(false, NEO::TimeoutControls::maxTimeout, buffer.taskCount);
 }
 
 } // namespace L0
@@ -17,6 +17,10 @@
 
 #include "igfxfmid.h"
 
+namespace NEO {
+class PageFaultManager;
+} // namespace NEO
+
 namespace L0 {
 
 template <GFXCORE_FAMILY gfxCoreFamily>
@@ -43,6 +47,20 @@ struct CommandQueueHw : public CommandQueueImp {
     size_t estimatePipelineSelect();
     void programPipelineSelect(NEO::LinearStream &commandStream);
 
+    void gatherCommandListsState(uint32_t numCommandLists,
+                                 ze_command_list_handle_t *phCommandLists,
+                                 NEO::PageFaultManager *pageFaultManager,
+                                 NEO::ResidencyContainer &commandListsResidency,
+                                 NEO::HeapContainer &heapContainer,
+                                 size_t &totalCmdBuffers);
+    void gatherIndirectAllocationsResidency(uint32_t numCommandLists,
+                                            ze_command_list_handle_t *phCommandLists,
+                                            NEO::PageFaultManager *pageFaultManager,
+                                            NEO::ResidencyContainer &commandListsResidency);
+    void addCommandListResidency(NEO::GraphicsAllocation *alloc,
+                                 NEO::PageFaultManager *pageFaultManager,
+                                 NEO::ResidencyContainer &commandListsResidency);
+
     MOCKABLE_VIRTUAL void handleScratchSpace(NEO::ResidencyContainer &residency,
                                              NEO::HeapContainer &heapContainer,
                                              NEO::ScratchSpaceController *scratchController,
@@ -15,10 +15,12 @@
 #include "shared/source/command_stream/preemption.h"
 #include "shared/source/command_stream/thread_arbitration_policy.h"
 #include "shared/source/device/device.h"
+#include "shared/source/direct_submission/submission_timeline.h"
 #include "shared/source/helpers/hw_helper.h"
 #include "shared/source/helpers/hw_info.h"
 #include "shared/source/helpers/interlocked_max.h"
 #include "shared/source/helpers/preamble.h"
+#include "shared/source/helpers/string.h"
 #include "shared/source/memory_manager/memory_manager.h"
 #include "shared/source/memory_manager/residency_container.h"
 #include "shared/source/os_interface/os_context.h"
@@ -36,6 +38,7 @@
 
 #include <limits>
 #include <thread>
+#include <unordered_set>
 
 namespace L0 {
 
@@ -69,16 +72,94 @@ ze_result_t CommandQueueHw<gfxCoreFamily>::executeCommandLists(
     using PIPE_CONTROL = typename GfxFamily::PIPE_CONTROL;
     using POST_SYNC_OPERATION = typename PIPE_CONTROL::POST_SYNC_OPERATION;
 
+    NEO::Device *neoDevice = device->getNEODevice();
+
+    NEO::SubmissionTimelineScope executeScope(NEO::SubmissionTimelineEvent::Enqueue, csr->getOsContextPtr());
+
+    NEO::PageFaultManager *pageFaultManager = nullptr;
+    if (performMigration) {
+        pageFaultManager = device->getDriverHandle()->getMemoryManager()->getPageFaultManager();
+        if (pageFaultManager == nullptr) {
+            performMigration = false;
+        }
+    }
+
+    //a repeated set of closed command lists was validated and gathered when its submission was recorded
+    bool replaySubmission = !performMigration && submissionReplay.matches(numCommandLists, phCommandLists);
+    bool recordSubmission = false;
+
+    NEO::ResidencyContainer commandListsResidency;
+    NEO::HeapContainer heapContainer;
+    size_t totalCmdBuffers = 0;
+
+    if (replaySubmission) {
+        heapContainer = submissionReplay.heapContainer;
+    } else {
+        for (auto i = 0u; i < numCommandLists; i++) {
+            auto commandList = CommandList::fromHandle(phCommandLists[i]);
+            if (isCopyOnlyCommandQueue != commandList->isCopyOnly()) {
+                return ZE_RESULT_ERROR_INVALID_COMMAND_LIST_TYPE;
+            }
+        }
+
+        //gather command list state before taking CSR ownership, so concurrent producers
+        //only serialize on programming and chaining of the queue command buffer
+        gatherCommandListsState(numCommandLists, phCommandLists, pageFaultManager, commandListsResidency, heapContainer, totalCmdBuffers);
+        recordSubmission = !performMigration && SubmissionReplay::isRecordable(numCommandLists, phCommandLists);
+    }
+
     auto lockCSR = csr->obtainUniqueOwnership();
 
-    for (auto i = 0u; i < numCommandLists; i++) {
-        auto commandList = CommandList::fromHandle(phCommandLists[i]);
-        if (isCopyOnlyCommandQueue != commandList->isCopyOnly()) {
-            return ZE_RESULT_ERROR_INVALID_COMMAND_LIST_TYPE;
+    NEO::ResidencyContainer residencyContainer;
+    auto scratchSpaceController = csr->getScratchSpaceController();
+    bool gsbaStateDirty = false;
+    bool frontEndStateDirty = false;
+    handleScratchSpace(residencyContainer,
+                       heapContainer,
+                       scratchSpaceController,
+                       gsbaStateDirty, frontEndStateDirty);
+
+    //scratch controller reports any scratch change, state is reprogrammed only when it differs from the last programmed one
+    uint64_t scratchAddress = scratchSpaceController->getScratchPatchAddress();
+    uint64_t generalStateBaseAddress = scratchSpaceController->calculateNewGSH();
+    bool indirectHeapInLocalMemory = false;
+    uint32_t threadArbitrationPolicy = NEO::ThreadArbitrationPolicy::NotPresent;
+    if (!isCopyOnlyCommandQueue) {
+        auto indirectHeap = CommandList::fromHandle(phCommandLists[0])->commandContainer.getIndirectHeap(NEO::HeapType::INDIRECT_OBJECT);
+        indirectHeapInLocalMemory = indirectHeap->getGraphicsAllocation()->isAllocatedInLocalMemoryPool();
+
+        auto &hwHelper = NEO::HwHelper::get(neoDevice->getHardwareInfo().platform.eRenderCoreFamily);
+        threadArbitrationPolicy = hwHelper.getDefaultThreadArbitrationPolicy();
+        if (NEO::DebugManager.flags.OverrideThreadArbitrationPolicy.get() != -1) {
+            threadArbitrationPolicy = static_cast<uint32_t>(NEO::DebugManager.flags.OverrideThreadArbitrationPolicy.get());
         }
     }
 
-    size_t spaceForResidency = 0;
+    frontEndStateDirty = !frontEndInit ||
+                         stateShadow.scratchAddress != scratchAddress ||
+                         stateShadow.perThreadScratchSize != commandQueuePerThreadScratchSize;
+    gsbaStateDirty = !gsbaInit ||
+                     stateShadow.generalStateBaseAddress != generalStateBaseAddress ||
+                     stateShadow.indirectHeapInLocalMemory != indirectHeapInLocalMemory;
+    bool threadArbitrationDirty = stateShadow.threadArbitrationPolicy != threadArbitrationPolicy;
+
+    if (replaySubmission) {
+        //recorded commands assume queue state is already programmed
+        replaySubmission = commandQueuePreemptionMode == submissionReplay.entryPreemptionMode &&
+                           (isCopyOnlyCommandQueue || (gpgpuEnabled && !gsbaStateDirty && !frontEndStateDirty && !threadArbitrationDirty));
+        if (!replaySubmission) {
+            heapContainer.clear();
+            gatherCommandListsState(numCommandLists, phCommandLists, pageFaultManager, commandListsResidency, heapContainer, totalCmdBuffers);
+            recordSubmission = SubmissionReplay::isRecordable(numCommandLists, phCommandLists);
+        }
+    }
+    if (!replaySubmission) {
+        //command lists with indirect access get internal allocations appended, other queues sharing this CSR may execute them too
+        gatherIndirectAllocationsResidency(numCommandLists, phCommandLists, pageFaultManager, commandListsResidency);
+    }
+    auto recordedResidencyStart = residencyContainer.size();
+
+    size_t spaceForResidency = 0u;
     size_t preemptionSize = 0u;
     size_t debuggerCmdsSize = 0;
     size_t threadArbitrationCmdSize = 0;
@@ -86,71 +167,70 @@ ze_result_t CommandQueueHw<gfxCoreFamily>::executeCommandLists(
     constexpr size_t residencyContainerSpaceForFence = 1;
     constexpr size_t residencyContainerSpaceForTagWrite = 1;
 
-    NEO::Device *neoDevice = device->getNEODevice();
     NEO::PreemptionMode statePreemption = commandQueuePreemptionMode;
     auto devicePreemption = device->getDevicePreemptionMode();
-    if (commandQueuePreemptionMode == NEO::PreemptionMode::Initial) {
-        preemptionSize += NEO::PreemptionHelper::getRequiredCmdStreamSize<GfxFamily>(commandQueuePreemptionMode,
-                                                                                     devicePreemption) +
-                          NEO::PreemptionHelper::getRequiredPreambleSize<GfxFamily>(*neoDevice) +
-                          NEO::PreemptionHelper::getRequiredStateSipCmdSize<GfxFamily>(*neoDevice);
-        statePreemption = devicePreemption;
-    }
+    size_t linearStreamSizeEstimate = csr->getCmdsSizeForHardwareContext();
 
-    threadArbitrationCmdSize = NEO::PreambleHelper<GfxFamily>::getThreadArbitrationCommandsSize();
-
-    if (!commandQueueDebugCmdsProgrammed) {
-        debuggerCmdsSize += NEO::PreambleHelper<GfxFamily>::getKernelDebuggingCommandsSize(neoDevice->isDebuggerActive());
-    }
+    if (replaySubmission) {
+        spaceForResidency += submissionReplay.residency.size();
+        linearStreamSizeEstimate += submissionReplay.commands.size();
+    } else {
+        spaceForResidency += commandListsResidency.size();
 
-    if (devicePreemption == NEO::PreemptionMode::MidThread) {
-        spaceForResidency += residencyContainerSpaceForPreemption;
-    }
+        if (commandQueuePreemptionMode == NEO::PreemptionMode::Initial) {
+            preemptionSize += NEO::PreemptionHelper::getRequiredCmdStreamSize<GfxFamily>(commandQueuePreemptionMode,
+                                                                                         devicePreemption) +
+                              NEO::PreemptionHelper::getRequiredPreambleSize<GfxFamily>(*neoDevice) +
+                              NEO::PreemptionHelper::getRequiredStateSipCmdSize<GfxFamily>(*neoDevice);
+            statePreemption = devicePreemption;
+        }
 
-    bool directSubmissionEnabled = csr->isDirectSubmissionEnabled();
+        if (threadArbitrationDirty) {
+            threadArbitrationCmdSize = NEO::PreambleHelper<GfxFamily>::getThreadArbitrationCommandsSize();
+        }
 
-    NEO::ResidencyContainer residencyContainer;
-    L0::Fence *fence = nullptr;
+        if (!commandQueueDebugCmdsProgrammed) {
+            debuggerCmdsSize += NEO::PreambleHelper<GfxFamily>::getKernelDebuggingCommandsSize(neoDevice->isDebuggerActive());
+        }
 
-    NEO::HeapContainer heapContainer;
-    heapContainer.reserve(numCommandLists);
+        if (devicePreemption == NEO::PreemptionMode::MidThread) {
+            spaceForResidency += residencyContainerSpaceForPreemption;
+        }
 
-    device->activateMetricGroups();
+        for (auto i = 0u; i < numCommandLists; i++) {
+            auto commandListPreemption = CommandList::fromHandle(phCommandLists[i])->getCommandListPreemptionMode();
+            if (statePreemption != commandListPreemption) {
+                preemptionSize += sizeof(PIPE_CONTROL);
+                preemptionSize += NEO::PreemptionHelper::getRequiredCmdStreamSize<GfxFamily>(commandListPreemption, statePreemption);
+                statePreemption = commandListPreemption;
+            }
+        }
 
-    size_t totalCmdBuffers = 0;
-    for (auto i = 0u; i < numCommandLists; i++) {
-        auto commandList = CommandList::fromHandle(phCommandLists[i]);
+        linearStreamSizeEstimate += totalCmdBuffers * sizeof(MI_BATCH_BUFFER_START);
 
-        bool indirectAllocationsAllowed = commandList->hasIndirectAllocationsAllowed();
-        if (indirectAllocationsAllowed) {
-            UnifiedMemoryControls unifiedMemoryControls = commandList->getUnifiedMemoryControls();
+        if (!isCopyOnlyCommandQueue) {
 
-            auto svmAllocsManager = device->getDriverHandle()->getSvmAllocsManager();
-            svmAllocsManager->addInternalAllocationsToResidencyContainer(neoDevice->getRootDeviceIndex(),
-                                                                         commandList->commandContainer.getResidencyContainer(),
-                                                                         unifiedMemoryControls.generateMask());
-        }
+            if (!gpgpuEnabled) {
+                linearStreamSizeEstimate += estimatePipelineSelect();
+            }
 
-        totalCmdBuffers += commandList->commandContainer.getCmdBufferAllocations().size();
-        spaceForResidency += commandList->commandContainer.getResidencyContainer().size();
-        auto commandListPreemption = commandList->getCommandListPreemptionMode();
-        if (statePreemption != commandListPreemption) {
-            preemptionSize += sizeof(PIPE_CONTROL);
-            preemptionSize += NEO::PreemptionHelper::getRequiredCmdStreamSize<GfxFamily>(commandListPreemption, statePreemption);
-            statePreemption = commandListPreemption;
-        }
+            if (frontEndStateDirty) {
+                linearStreamSizeEstimate += estimateFrontEndCmdSize();
+            }
 
-        interlockedMax(commandQueuePerThreadScratchSize, commandList->getCommandListPerThreadScratchSize());
-        if (commandList->getCommandListPerThreadScratchSize() != 0) {
-            heapContainer.push_back(commandList->commandContainer.getIndirectHeap(NEO::HeapType::SURFACE_STATE)->getGraphicsAllocation());
-            for (auto element : commandList->commandContainer.sshAllocations) {
-                heapContainer.push_back(element);
+            if (gsbaStateDirty) {
+                linearStreamSizeEstimate += estimateStateBaseAddressCmdSize();
             }
+
+            linearStreamSizeEstimate += threadArbitrationCmdSize + preemptionSize + debuggerCmdsSize;
         }
     }
 
-    size_t linearStreamSizeEstimate = totalCmdBuffers * sizeof(MI_BATCH_BUFFER_START);
-    linearStreamSizeEstimate += csr->getCmdsSizeForHardwareContext();
+    bool directSubmissionEnabled = csr->isDirectSubmissionEnabled();
+
+    L0::Fence *fence = nullptr;
+
+    device->activateMetricGroups();
 
     if (directSubmissionEnabled) {
         linearStreamSizeEstimate += sizeof(MI_BATCH_BUFFER_START);
@@ -166,152 +246,146 @@ ze_result_t CommandQueueHw<gfxCoreFamily>::executeCommandLists(
 
     spaceForResidency += residencyContainerSpaceForTagWrite;
 
-    residencyContainer.reserve(spaceForResidency);
-
-    auto scratchSpaceController = csr->getScratchSpaceController();
-    bool gsbaStateDirty = false;
-    bool frontEndStateDirty = false;
-    handleScratchSpace(residencyContainer,
-                       heapContainer,
-                       scratchSpaceController,
-                       gsbaStateDirty, frontEndStateDirty);
-
-    gsbaStateDirty |= !gsbaInit;
-    frontEndStateDirty |= !frontEndInit;
-    if (!isCopyOnlyCommandQueue) {
-
-        if (!gpgpuEnabled) {
-            linearStreamSizeEstimate += estimatePipelineSelect();
-        }
-
-        if (frontEndStateDirty) {
-            linearStreamSizeEstimate += estimateFrontEndCmdSize();
-        }
-
-        if (gsbaStateDirty) {
-            linearStreamSizeEstimate += estimateStateBaseAddressCmdSize();
-        }
-
-        linearStreamSizeEstimate += threadArbitrationCmdSize + preemptionSize + debuggerCmdsSize;
-    }
+    residencyContainer.reserve(residencyContainer.size() + spaceForResidency);
 
     linearStreamSizeEstimate += isCopyOnlyCommandQueue ? NEO::EncodeMiFlushDW<GfxFamily>::getMiFlushDwCmdSizeForDataWrite() : NEO::MemorySynchronizationCommands<GfxFamily>::getSizeForPipeControlWithPostSyncOperation(device->getHwInfo());
+    if (!isCopyOnlyCommandQueue && NEO::SubmissionTimeline::isEnabled()) {
+        linearStreamSizeEstimate += NEO::MemorySynchronizationCommands<GfxFamily>::getSizeForPipeControlWithPostSyncOperation(device->getHwInfo());
+    }
     size_t alignedSize = alignUp<size_t>(linearStreamSizeEstimate, minCmdBufferPtrAlign);
     size_t padding = alignedSize - linearStreamSizeEstimate;
     reserveLinearStreamSize(alignedSize);
     NEO::LinearStream child(commandStream->getSpace(alignedSize), alignedSize);
 
-    const auto globalFenceAllocation = csr->getGlobalFenceAllocation();
-    if (globalFenceAllocation) {
-        residencyContainer.push_back(globalFenceAllocation);
-    }
-
     csr->programHardwareContext(child);
 
-    if (device->getL0Debugger()) {
-        residencyContainer.push_back(device->getL0Debugger()->getSbaTrackingBuffer(csr->getOsContext().getContextId()));
-    }
-
-    if (!isCopyOnlyCommandQueue) {
-        if (!gpgpuEnabled) {
-            programPipelineSelect(child);
+    if (replaySubmission) {
+        auto commands = child.getSpace(submissionReplay.commands.size());
+        memcpy_s(commands, submissionReplay.commands.size(), submissionReplay.commands.data(), submissionReplay.commands.size());
+        residencyContainer.insert(residencyContainer.end(), submissionReplay.residency.begin(), submissionReplay.residency.end());
+        statePreemption = submissionReplay.exitPreemptionMode;
+        emittedStateCommandsCount += submissionReplay.stateCommandsCount;
+
+        for (auto i = 0u; i < numCommandLists; ++i) {
+            auto commandList = CommandList::fromHandle(phCommandLists[i]);
+            printfFunctionContainer.insert(printfFunctionContainer.end(),
+                                           commandList->getPrintfFunctionContainer().begin(),
+                                           commandList->getPrintfFunctionContainer().end());
         }
-
-        if (!commandQueueDebugCmdsProgrammed && neoDevice->isDebuggerActive()) {
-            NEO::PreambleHelper<GfxFamily>::programKernelDebugging(&child);
-            commandQueueDebugCmdsProgrammed = true;
+        replayedSubmissionsCount++;
+    } else {
+        const auto globalFenceAllocation = csr->getGlobalFenceAllocation();
+        if (globalFenceAllocation) {
+            residencyContainer.push_back(globalFenceAllocation);
         }
 
-        if (frontEndStateDirty) {
-            programFrontEnd(scratchSpaceController->getScratchPatchAddress(), child);
-        }
-        if (gsbaStateDirty) {
-            auto indirectHeap = CommandList::fromHandle(phCommandLists[0])->commandContainer.getIndirectHeap(NEO::HeapType::INDIRECT_OBJECT);
-            programGeneralStateBaseAddress(scratchSpaceController->calculateNewGSH(), indirectHeap->getGraphicsAllocation()->isAllocatedInLocalMemoryPool(), child);
+        if (device->getL0Debugger()) {
+            residencyContainer.push_back(device->getL0Debugger()->getSbaTrackingBuffer(csr->getOsContext().getContextId()));
         }
 
-        if (commandQueuePreemptionMode == NEO::PreemptionMode::Initial) {
-            NEO::PreemptionHelper::programCsrBaseAddress<GfxFamily>(child, *neoDevice, csr->getPreemptionAllocation());
-            NEO::PreemptionHelper::programStateSip<GfxFamily>(child, *neoDevice);
-            NEO::PreemptionHelper::programCmdStream<GfxFamily>(child,
-                                                               devicePreemption,
-                                                               commandQueuePreemptionMode,
-                                                               csr->getPreemptionAllocation());
-            commandQueuePreemptionMode = devicePreemption;
-            statePreemption = commandQueuePreemptionMode;
-        }
+        if (!isCopyOnlyCommandQueue) {
+            if (!gpgpuEnabled) {
+                programPipelineSelect(child);
+            }
 
-        auto &hwHelper = NEO::HwHelper::get(neoDevice->getHardwareInfo().platform.eRenderCoreFamily);
-        uint32_t threadArbitrationPolicy = hwHelper.getDefaultThreadArbitrationPolicy();
-        if (NEO::DebugManager.flags.OverrideThreadArbitrationPolicy.get() != -1) {
-            threadArbitrationPolicy = static_cast<uint32_t>(NEO::DebugManager.flags.OverrideThreadArbitrationPolicy.get());
-        }
+            if (!commandQueueDebugCmdsProgrammed && neoDevice->isDebuggerActive()) {
+                NEO::PreambleHelper<GfxFamily>::programKernelDebugging(&child);
+                commandQueueDebugCmdsProgrammed = true;
+                emittedStateCommandsCount++;
+            }
 
-        NEO::PreambleHelper<GfxFamily>::programThreadArbitration(&child, threadArbitrationPolicy);
+            if (frontEndStateDirty) {
+                programFrontEnd(scratchAddress, child);
+            }
+            if (gsbaStateDirty) {
+                programGeneralStateBaseAddress(generalStateBaseAddress, indirectHeapInLocalMemory, child);
+            }
 
-        const bool sipKernelUsed = devicePreemption == NEO::PreemptionMode::MidThread ||
-                                   neoDevice->isDebuggerActive();
-        if (devicePreemption == NEO::PreemptionMode::MidThread) {
-            residencyContainer.push_back(csr->getPreemptionAllocation());
-        }
+            if (commandQueuePreemptionMode == NEO::PreemptionMode::Initial) {
+                NEO::PreemptionHelper::programCsrBaseAddress<GfxFamily>(child, *neoDevice, csr->getPreemptionAllocation());
+                NEO::PreemptionHelper::programStateSip<GfxFamily>(child, *neoDevice);
+                NEO::PreemptionHelper::programCmdStream<GfxFamily>(child,
+                                                                   devicePreemption,
+                                                                   commandQueuePreemptionMode,
+                                                                   csr->getPreemptionAllocation());
+                commandQueuePreemptionMode = devicePreemption;
+                statePreemption = commandQueuePreemptionMode;
+                emittedStateCommandsCount++;
+            }
 
-        if (sipKernelUsed) {
-            auto sipIsa = NEO::SipKernel::getSipKernelAllocation(*neoDevice);
-            residencyContainer.push_back(sipIsa);
-        }
+            if (threadArbitrationDirty) {
+                NEO::PreambleHelper<GfxFamily>::programThreadArbitration(&child, threadArbitrationPolicy);
+                stateShadow.threadArbitrationPolicy = threadArbitrationPolicy;
+                emittedStateCommandsCount++;
+            }
 
-        if (neoDevice->getDebugger()) {
-            UNRECOVERABLE_IF(device->getDebugSurface() == nullptr);
-            residencyContainer.push_back(device->getDebugSurface());
-        }
-    }
-    for (auto i = 0u; i < numCommandLists; ++i) {
-        auto commandList = CommandList::fromHandle(phCommandLists[i]);
-        auto cmdBufferAllocations = commandList->commandContainer.getCmdBufferAllocations();
-        auto cmdBufferCount = cmdBufferAllocations.size();
-
-        auto commandListPreemption = commandList->getCommandListPreemptionMode();
-        if (statePreemption != commandListPreemption) {
-            NEO::PipeControlArgs args;
-            NEO::MemorySynchronizationCommands<GfxFamily>::addPipeControl(child, args);
-            NEO::PreemptionHelper::programCmdStream<GfxFamily>(child,
-                                                               commandListPreemption,
-                                                               statePreemption,
-                                                               csr->getPreemptionAllocation());
-            statePreemption = commandListPreemption;
-        }
+            const bool sipKernelUsed = devicePreemption == NEO::PreemptionMode::MidThread ||
+                                       neoDevice->isDebuggerActive();
+            if (devicePreemption == NEO::PreemptionMode::MidThread) {
+                residencyContainer.push_back(csr->getPreemptionAllocation());
+            }
 
-        for (size_t iter = 0; iter < cmdBufferCount; iter++) {
-            auto allocation = cmdBufferAllocations[iter];
-            NEO::EncodeBatchBufferStartOrEnd<GfxFamily>::programBatchBufferStart(&child, allocation->getGpuAddress(), true);
+            if (sipKernelUsed) {
+                auto sipIsa = NEO::SipKernel::getSipKernelAllocation(*neoDevice);
+                residencyContainer.push_back(sipIsa);
+            }
+
+            if (neoDevice->getDebugger()) {
+                UNRECOVERABLE_IF(device->getDebugSurface() == nullptr);
+                residencyContainer.push_back(device->getDebugSurface());
+            }
         }
 
-        printfFunctionContainer.insert(printfFunctionContainer.end(),
-                                       commandList->getPrintfFunctionContainer().begin(),
-                                       commandList->getPrintfFunctionContainer().end());
+        auto entryPreemptionMode = statePreemption;
+        auto recordedCommandsStart = child.getUsed();
+        auto recordedStateCommandsStart = emittedStateCommandsCount;
+
+        for (auto i = 0u; i < numCommandLists; ++i) {
+            auto commandList = CommandList::fromHandle(phCommandLists[i]);
+            auto cmdBufferAllocations = commandList->commandContainer.getCmdBufferAllocations();
+            auto cmdBufferCount = cmdBufferAllocations.size();
+
+            auto commandListPreemption = commandList->getCommandListPreemptionMode();
+            if (statePreemption != commandListPreemption) {
+                NEO::PipeControlArgs args;
+                NEO::MemorySynchronizationCommands<GfxFamily>::addPipeControl(child, args);
+                NEO::PreemptionHelper::programCmdStream<GfxFamily>(child,
+                                                                   commandListPreemption,
+                                                                   statePreemption,
+                                                                   csr->getPreemptionAllocation());
+                statePreemption = commandListPreemption;
+                emittedStateCommandsCount++;
+            }
 
-        NEO::PageFaultManager *pageFaultManager = nullptr;
-        if (performMigration) {
-            pageFaultManager = device->getDriverHandle()->getMemoryManager()->getPageFaultManager();
-            if (pageFaultManager == nullptr) {
-                performMigration = false;
+            for (size_t iter = 0; iter < cmdBufferCount; iter++) {
+                auto allocation = cmdBufferAllocations[iter];
+                NEO::EncodeBatchBufferStartOrEnd<GfxFamily>::programBatchBufferStart(&child, allocation->getGpuAddress(), true);
             }
+
+            printfFunctionContainer.insert(printfFunctionContainer.end(),
+                                           commandList->getPrintfFunctionContainer().begin(),
+                                           commandList->getPrintfFunctionContainer().end());
         }
 
-        for (auto alloc : commandList->commandContainer.getResidencyContainer()) {
-            if (residencyContainer.end() ==
-                std::find(residencyContainer.begin(), residencyContainer.end(), alloc)) {
+        auto queueResidencyEnd = residencyContainer.size();
+        for (auto alloc : commandListsResidency) {
+            auto queueResidencyLast = residencyContainer.begin() + queueResidencyEnd;
+            if (queueResidencyLast == std::find(residencyContainer.begin(), queueResidencyLast, alloc)) {
                 residencyContainer.push_back(alloc);
-
-                if (performMigration) {
-                    if (alloc &&
-                        (alloc->getAllocationType() == NEO::GraphicsAllocation::AllocationType::SVM_GPU ||
-                         alloc->getAllocationType() == NEO::GraphicsAllocation::AllocationType::SVM_CPU)) {
-                        pageFaultManager->moveAllocationToGpuDomain(reinterpret_cast<void *>(alloc->getGpuAddress()));
-                    }
-                }
             }
         }
+
+        if (recordSubmission) {
+            auto recordedCommands = ptrOffset(child.getCpuBase(), recordedCommandsStart);
+            submissionReplay.commands.assign(static_cast<uint8_t *>(recordedCommands),
+                                             static_cast<uint8_t *>(recordedCommands) + (child.getUsed() - recordedCommandsStart));
+            submissionReplay.residency.assign(residencyContainer.begin() + recordedResidencyStart, residencyContainer.end());
+            submissionReplay.heapContainer = heapContainer;
+            submissionReplay.entryPreemptionMode = entryPreemptionMode;
+            submissionReplay.exitPreemptionMode = statePreemption;
+            submissionReplay.stateCommandsCount = emittedStateCommandsCount - recordedStateCommandsStart;
+            submissionReplay.record(numCommandLists, phCommandLists);
+        }
     }
 
     commandQueuePreemptionMode = statePreemption;
@@ -352,6 +426,7 @@ ze_result_t CommandQueueHw<gfxCoreFamily>::executeCommandLists(
     submitBatchBuffer(ptrDiff(child.getCpuBase(), commandStream->getCpuBase()), residencyContainer, endingCmd);
 
     this->taskCount = csr->peekTaskCount();
+    executeScope.setValue(this->taskCount);
 
     csr->makeSurfacePackNonResident(residencyContainer);
 
@@ -362,6 +437,108 @@ ze_result_t CommandQueueHw<gfxCoreFamily>::executeCommandLists(
     return ZE_RESULT_SUCCESS;
 }
 
+template <GFXCORE_FAMILY gfxCoreFamily>
+void CommandQueueHw<gfxCoreFamily>::gatherCommandListsState(uint32_t numCommandLists,
+                                                            ze_command_list_handle_t *phCommandLists,
+                                                            NEO::PageFaultManager *pageFaultManager,
+                                                            NEO::ResidencyContainer &commandListsResidency,
+                                                            NEO::HeapContainer &heapContainer,
+                                                            size_t &totalCmdBuffers) {
+    std::unordered_set<NEO::GraphicsAllocation *> commandListsResidencySet;
+    heapContainer.reserve(numCommandLists);
+
+    //closed command lists hold unique allocations, hashing is needed only to merge several of them
+    bool mergeResidency = numCommandLists > 1;
+    if (mergeResidency) {
+        size_t totalResidencySize = 0;
+        for (auto i = 0u; i < numCommandLists; i++) {
+            auto commandList = CommandList::fromHandle(phCommandLists[i]);
+            if (!commandList->hasIndirectAllocationsAllowed()) {
+                totalResidencySize += commandList->commandContainer.getResidencyContainer().size();
+            }
+        }
+        commandListsResidencySet.reserve(totalResidencySize);
+        commandListsResidency.reserve(totalResidencySize);
+    }
+
+    for (auto i = 0u; i < numCommandLists; i++) {
+        auto commandList = CommandList::fromHandle(phCommandLists[i]);
+
+        totalCmdBuffers += commandList->commandContainer.getCmdBufferAllocations().size();
+
+        interlockedMax(commandQueuePerThreadScratchSize, commandList->getCommandListPerThreadScratchSize());
+        if (commandList->getCommandListPerThreadScratchSize() != 0) {
+            heapContainer.push_back(commandList->commandContainer.getIndirectHeap(NEO::HeapType::SURFACE_STATE)->getGraphicsAllocation());
+            for (auto element : commandList->commandContainer.sshAllocations) {
+                heapContainer.push_back(element);
+            }
+        }
+
+        //residency of such list is extended at execution, it is gathered under CSR ownership
+        if (commandList->hasIndirectAllocationsAllowed()) {
+            continue;
+        }
+        for (auto alloc : commandList->commandContainer.getResidencyContainer()) {
+            if (!mergeResidency || commandListsResidencySet.insert(alloc).second) {
+                addCommandListResidency(alloc, pageFaultManager, commandListsResidency);
+            }
+        }
+    }
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+void CommandQueueHw<gfxCoreFamily>::gatherIndirectAllocationsResidency(uint32_t numCommandLists,
+                                                                       ze_command_list_handle_t *phCommandLists,
+                                                                       NEO::PageFaultManager *pageFaultManager,
+                                                                       NEO::ResidencyContainer &commandListsResidency) {
+    NEO::Device *neoDevice = device->getNEODevice();
+    std::unordered_set<NEO::GraphicsAllocation *> commandListsResidencySet;
+    bool mergeResidency = numCommandLists > 1;
+    bool residencySetFilled = false;
+
+    for (auto i = 0u; i < numCommandLists; i++) {
+        auto commandList = CommandList::fromHandle(phCommandLists[i]);
+        if (!commandList->hasIndirectAllocationsAllowed()) {
+            continue;
+        }
+        if (mergeResidency && !residencySetFilled) {
+            commandListsResidencySet.insert(commandListsResidency.begin(), commandListsResidency.end());
+            residencySetFilled = true;
+        }
+
+        //replace internal allocations added by previous executions, instead of deduplicating whole residency again
+        auto &residencyContainer = commandList->commandContainer.getResidencyContainer();
+        residencyContainer.resize(std::min(commandList->getResidencyTrackedCount(), residencyContainer.size()));
+
+        UnifiedMemoryControls unifiedMemoryControls = commandList->getUnifiedMemoryControls();
+        auto svmAllocsManager = device->getDriverHandle()->getSvmAllocsManager();
+        svmAllocsManager->addInternalAllocationsToResidencyContainer(neoDevice->getRootDeviceIndex(),
+                                                                     residencyContainer,
+                                                                     unifiedMemoryControls.generateMask());
+
+        for (auto alloc : residencyContainer) {
+            if (!mergeResidency || commandListsResidencySet.insert(alloc).second) {
+                addCommandListResidency(alloc, pageFaultManager, commandListsResidency);
+            }
+        }
+    }
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+void CommandQueueHw<gfxCoreFamily>::addCommandListResidency(NEO::GraphicsAllocation *alloc,
+                                                            NEO::PageFaultManager *pageFaultManager,
+                                                            NEO::ResidencyContainer &commandListsResidency) {
+    commandListsResidency.push_back(alloc);
+
+    if (pageFaultManager) {
+        if (alloc &&
+            (alloc->getAllocationType() == NEO::GraphicsAllocation::AllocationType::SVM_GPU ||
+             alloc->getAllocationType() == NEO::GraphicsAllocation::AllocationType::SVM_CPU)) {
+            pageFaultManager->moveAllocationToGpuDomain(reinterpret_cast<void *>(alloc->getGpuAddress()));
+        }
+    }
+}
+
 template <GFXCORE_FAMILY gfxCoreFamily>
 void CommandQueueHw<gfxCoreFamily>::programFrontEnd(uint64_t scratchAddress, NEO::LinearStream &commandStream) {
     using GfxFamily = typename NEO::GfxFamilyMapper<gfxCoreFamily>::GfxFamily;
@@ -374,6 +551,9 @@ void CommandQueueHw<gfxCoreFamily>::programFrontEnd(uint64_t scratchAddress, NEO
                                                     csr->getOsContext().getEngineType(),
                                                     NEO::AdditionalKernelExecInfo::NotApplicable);
     frontEndInit = true;
+    stateShadow.scratchAddress = scratchAddress;
+    stateShadow.perThreadScratchSize = commandQueuePerThreadScratchSize;
+    emittedStateCommandsCount++;
 }
 
 template <GFXCORE_FAMILY gfxCoreFamily>
@@ -395,6 +575,7 @@ void CommandQueueHw<gfxCoreFamily>::programPipelineSelect(NEO::LinearStream &com
     using GfxFamily = typename NEO::GfxFamilyMapper<gfxCoreFamily>::GfxFamily;
     NEO::PreambleHelper<GfxFamily>::programPipelineSelect(&commandStream, args, device->getHwInfo());
     gpgpuEnabled = true;
+    emittedStateCommandsCount++;
 }
 
 template <GFXCORE_FAMILY gfxCoreFamily>
@@ -411,6 +592,17 @@ void CommandQueueHw<gfxCoreFamily>::dispatchTaskCountWrite(NEO::LinearStream &co
     if (isCopyOnlyCommandQueue) {
         NEO::EncodeMiFlushDW<GfxFamily>::programMiFlushDw(commandStream, gpuAddress, taskCountToWrite, false, true);
     } else {
+        if (NEO::SubmissionTimeline::isEnabled()) {
+            csr->prepareCompletionTimestamp(*device->getNEODevice(), taskCountToWrite);
+            NEO::PipeControlArgs timestampArgs;
+            NEO::MemorySynchronizationCommands<GfxFamily>::addPipeControlAndProgramPostSyncOperation(
+                commandStream,
+                POST_SYNC_OPERATION::POST_SYNC_OPERATION_WRITE_TIMESTAMP,
+                csr->getCompletionTimestampGPUAddress(taskCountToWrite),
+                0llu,
+                device->getHwInfo(),
+                timestampArgs);
+        }
         NEO::PipeControlArgs args(true);
         NEO::MemorySynchronizationCommands<GfxFamily>::addPipeControlAndProgramPostSyncOperation(
             commandStream,
@@ -65,6 +65,9 @@ void CommandQueueHw<gfxCoreFamily>::programGeneralStateBaseAddress(uint64_t gsba
                                                                     false);
     *pSbaCmd = sbaCmd;
     gsbaInit = true;
+    stateShadow.generalStateBaseAddress = gsba;
+    stateShadow.indirectHeapInLocalMemory = useLocalMemoryForIndirectHeap;
+    emittedStateCommandsCount++;
 
     if (device->getL0Debugger()) {
 
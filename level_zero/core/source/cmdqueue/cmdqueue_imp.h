@@ -9,7 +9,9 @@
 
 #include "shared/source/command_stream/csr_definitions.h"
 #include "shared/source/command_stream/submissions_aggregator.h"
+#include "shared/source/command_stream/thread_arbitration_policy.h"
 #include "shared/source/helpers/constants.h"
+#include "shared/source/memory_manager/residency_container.h"
 
 #include "level_zero/core/source/cmdqueue/cmdqueue.h"
 
@@ -28,29 +30,74 @@ struct Kernel;
 struct CommandQueueImp : public CommandQueue {
     class CommandBufferManager {
       public:
-        enum BUFFER_ALLOCATION : uint32_t {
-            FIRST = 0,
-            SECOND,
-            COUNT
-        };
+        static constexpr uint32_t initialBuffersCount = 2u;
+        static constexpr uint32_t defaultMaxBuffersCount = 8u;
 
         void initialize(Device *device, size_t sizeRequested);
         void destroy(NEO::MemoryManager *memoryManager);
         void switchBuffers(NEO::CommandStreamReceiver *csr);
 
         NEO::GraphicsAllocation *getCurrentBufferAllocation() {
-            return buffers[bufferUse];
+            return buffers[bufferUse].allocation;
+        }
+
+        void setCurrentFlushStamp(NEO::FlushStamp flushStamp, uint32_t taskCount) {
+            buffers[bufferUse].flushStamp = flushStamp;
+            buffers[bufferUse].taskCount = taskCount;
+        }
+
+        size_t getBuffersCount() const {
+            return buffers.size();
+        }
+
+        uint32_t getMaxBuffersCount() const {
+            return maxBuffersCount;
         }
 
-        void setCurrentFlushStamp(NEO::FlushStamp flushStamp) {
-            flushId[bufferUse] = flushStamp;
+        uint64_t getStallCount() const {
+            return stallCount;
         }
 
-      private:
-        NEO::GraphicsAllocation *buffers[BUFFER_ALLOCATION::COUNT];
-        NEO::FlushStamp flushId[BUFFER_ALLOCATION::COUNT];
-        BUFFER_ALLOCATION bufferUse = BUFFER_ALLOCATION::FIRST;
+      protected:
+        struct CommandBuffer {
+            NEO::GraphicsAllocation *allocation = nullptr;
+            NEO::FlushStamp flushStamp = 0u;
+            uint32_t taskCount = 0u;
+        };
+
+        CommandBuffer allocateBuffer();
+
+        std::vector<CommandBuffer> buffers;
+        Device *device = nullptr;
+        size_t bufferSize = 0u;
+        size_t bufferUse = 0u;
+        uint32_t maxBuffersCount = defaultMaxBuffersCount;
+        uint64_t stallCount = 0u;
+    };
+    struct SubmissionReplay {
+        static bool isRecordable(uint32_t numCommandLists, ze_command_list_handle_t *phCommandLists);
+        bool matches(uint32_t numCommandLists, ze_command_list_handle_t *phCommandLists) const;
+        void record(uint32_t numCommandLists, ze_command_list_handle_t *phCommandLists);
+
+        std::vector<ze_command_list_handle_t> commandLists;
+        std::vector<uint64_t> closedGenerations;
+        std::vector<NEO::GraphicsAllocation *> heapContainer;
+        NEO::ResidencyContainer residency;
+        std::vector<uint8_t> commands;
+        NEO::PreemptionMode entryPreemptionMode = NEO::PreemptionMode::Initial;
+        NEO::PreemptionMode exitPreemptionMode = NEO::PreemptionMode::Initial;
+        uint32_t stateCommandsCount = 0u;
+        bool valid = false;
+    };
+
+    struct StateShadow {
+        uint64_t scratchAddress = 0u;
+        uint64_t generalStateBaseAddress = 0u;
+        uint32_t perThreadScratchSize = 0u;
+        uint32_t threadArbitrationPolicy = NEO::ThreadArbitrationPolicy::NotPresent;
+        bool indirectHeapInLocalMemory = false;
     };
+
     static constexpr size_t defaultQueueCmdBufferSize = 128 * MemoryConstants::kiloByte;
     static constexpr size_t minCmdBufferPtrAlign = 8;
     static constexpr size_t totalCmdBufferSize =
@@ -74,6 +121,10 @@ struct CommandQueueImp : public CommandQueue {
 
     uint32_t getTaskCount() { return taskCount; }
 
+    uint32_t getReplayedSubmissionsCount() const { return replayedSubmissionsCount; }
+
+    uint32_t getEmittedStateCommandsCount() const { return emittedStateCommandsCount; }
+
     NEO::CommandStreamReceiver *getCsr() { return csr; }
 
     void reserveLinearStreamSize(size_t size);
@@ -97,6 +148,10 @@ struct CommandQueueImp : public CommandQueue {
     bool frontEndInit = false;
     bool gpgpuEnabled = false;
     CommandBufferManager buffers;
+    SubmissionReplay submissionReplay;
+    uint32_t replayedSubmissionsCount = 0u;
+    StateShadow stateShadow;
+    uint32_t emittedStateCommandsCount = 0u;
 };
 
 } // namespace L0
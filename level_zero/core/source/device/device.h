@@ -30,6 +30,7 @@ struct DeviceInfo;
 namespace L0 {
 struct DriverHandle;
 struct BuiltinFunctionsLib;
+class HostPtrAllocationCache;
 struct ExecutionEnvironment;
 struct MetricContext;
 struct SysmanDevice;
@@ -120,6 +121,7 @@ struct Device : _ze_device_handle_t {
                                                                       size_t size, struct CommandList *commandList) = 0;
 
     virtual NEO::GraphicsAllocation *allocateMemoryFromHostPtr(const void *buffer, size_t size) = 0;
+    virtual HostPtrAllocationCache *getHostPtrAllocationCache() = 0;
     virtual void setSysmanHandle(SysmanDevice *pSysmanDevice) = 0;
     virtual SysmanDevice *getSysmanHandle() = 0;
     virtual ze_result_t getCsrForOrdinalAndIndex(NEO::CommandStreamReceiver **csr, uint32_t ordinal, uint32_t index) = 0;
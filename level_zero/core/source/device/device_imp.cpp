@@ -87,6 +87,9 @@ ze_result_t DeviceImp::createCommandList(const ze_command_list_desc_t *desc,
     mapOrdinalForAvailableEngineGroup(&engineGroupIndex);
     ze_result_t returnValue = ZE_RESULT_SUCCESS;
     *commandList = CommandList::create(productFamily, this, static_cast<NEO::EngineGroupType>(engineGroupIndex), returnValue);
+    if (returnValue == ZE_RESULT_SUCCESS && (desc->flags & ZE_COMMAND_LIST_FLAG_RELAXED_ORDERING)) {
+        CommandList::fromHandle(*commandList)->initializeBarrierElision(true);
+    }
 
     return returnValue;
 }
@@ -555,6 +558,7 @@ Device *Device::create(DriverHandle *driverHandle, NEO::Device *neoDevice, uint3
     device->builtins = BuiltinFunctionsLib::create(
         device, neoDevice->getBuiltIns());
     device->maxNumHwThreads = NEO::HwHelper::getMaxThreadsForVfe(neoDevice->getHardwareInfo());
+    device->hostPtrAllocationCache = std::make_unique<HostPtrAllocationCache>(*device);
 
     const bool allocateDebugSurface = (device->getL0Debugger() || neoDevice->getDeviceInfo().debuggerActive) && !isSubDevice;
     NEO::GraphicsAllocation *debugSurface = nullptr;
@@ -650,6 +654,7 @@ void DeviceImp::releaseResources() {
         this->pageFaultCommandList->destroy();
         this->pageFaultCommandList = nullptr;
     }
+    hostPtrAllocationCache.reset();
     metricContext.reset();
     builtins.reset();
 
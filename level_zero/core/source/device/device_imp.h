@@ -10,6 +10,7 @@
 #include "level_zero/core/source/builtin/builtin_functions_lib.h"
 #include "level_zero/core/source/cmdlist/cmdlist.h"
 #include "level_zero/core/source/device/device.h"
+#include "level_zero/core/source/device/host_ptr_allocation_cache.h"
 #include "level_zero/core/source/driver/driver_handle.h"
 #include "level_zero/tools/source/metrics/metric.h"
 
@@ -76,6 +77,7 @@ struct DeviceImp : public Device {
     ~DeviceImp() override;
     NEO::GraphicsAllocation *allocateManagedMemoryFromHostPtr(void *buffer, size_t size, struct CommandList *commandList) override;
     NEO::GraphicsAllocation *allocateMemoryFromHostPtr(const void *buffer, size_t size) override;
+    HostPtrAllocationCache *getHostPtrAllocationCache() override { return hostPtrAllocationCache.get(); }
     void setSysmanHandle(SysmanDevice *pSysman) override;
     SysmanDevice *getSysmanHandle() override;
     ze_result_t getCsrForOrdinalAndIndex(NEO::CommandStreamReceiver **csr, uint32_t ordinal, uint32_t index) override;
@@ -91,6 +93,7 @@ struct DeviceImp : public Device {
     std::vector<Device *> subDevices;
     DriverHandle *driverHandle = nullptr;
     CommandList *pageFaultCommandList = nullptr;
+    std::unique_ptr<HostPtrAllocationCache> hostPtrAllocationCache;
 
     bool resourcesReleased = false;
     void releaseResources();
@@ -0,0 +1,106 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "level_zero/core/source/device/host_ptr_allocation_cache.h"
+
+#include "shared/source/helpers/debug_helpers.h"
+#include "shared/source/helpers/ptr_math.h"
+#include "shared/source/memory_manager/graphics_allocation.h"
+#include "shared/source/memory_manager/memory_manager.h"
+
+#include "level_zero/core/source/device/device.h"
+
+namespace L0 {
+
+HostPtrAllocationCache::~HostPtrAllocationCache() {
+    auto memoryManager = device.getNEODevice()->getMemoryManager();
+    for (auto &entry : entries) {
+        memoryManager->checkGpuUsageAndDestroyGraphicsAllocations(entry.first);
+    }
+}
+
+NEO::GraphicsAllocation *HostPtrAllocationCache::acquire(const void *buffer, size_t size) {
+    std::lock_guard<std::mutex> lock(mtx);
+
+    auto allocation = findCachedAllocation(buffer, size);
+    if (allocation) {
+        entries[allocation].refCount++;
+        return allocation;
+    }
+
+    allocation = device.allocateMemoryFromHostPtr(buffer, size);
+    if (allocation == nullptr) {
+        return nullptr;
+    }
+
+    Entry entry;
+    entry.hostPtr = buffer;
+    entry.refCount = 1u;
+    //allocations holding a copy of host memory do not track later host writes, so they are never shared
+    entry.cacheable = allocation->getAllocationType() == NEO::GraphicsAllocation::AllocationType::EXTERNAL_HOST_PTR;
+
+    if (entry.cacheable) {
+        //referenced allocation at the same address not covering the whole range stays private to its users
+        auto previous = rangeMap.find(buffer);
+        if (previous != rangeMap.end()) {
+            entries[previous->second].cacheable = false;
+        }
+        rangeMap[buffer] = allocation;
+    }
+    entries.insert({allocation, entry});
+    return allocation;
+}
+
+bool HostPtrAllocationCache::release(NEO::GraphicsAllocation *allocation) {
+    std::lock_guard<std::mutex> lock(mtx);
+
+    auto it = entries.find(allocation);
+    if (it == entries.end()) {
+        return false;
+    }
+
+    auto &entry = it->second;
+    UNRECOVERABLE_IF(entry.refCount == 0u);
+    entry.refCount--;
+    if (entry.refCount == 0u) {
+        //host memory may be freed and its address reused once no command list references it
+        if (entry.cacheable) {
+            rangeMap.erase(entry.hostPtr);
+        }
+        destroyEntry(allocation);
+    }
+    return true;
+}
+
+size_t HostPtrAllocationCache::getEntriesCount() const {
+    std::lock_guard<std::mutex> lock(mtx);
+    return entries.size();
+}
+
+NEO::GraphicsAllocation *HostPtrAllocationCache::findCachedAllocation(const void *buffer, size_t size) const {
+    auto allocation = rangeMap.lower_bound(buffer);
+    if (allocation != rangeMap.end()) {
+        if (buffer == allocation->first && ptrOffset(allocation->first, allocation->second->getUnderlyingBufferSize()) >= ptrOffset(buffer, size)) {
+            return allocation->second;
+        }
+    }
+    if (allocation != rangeMap.begin()) {
+        allocation--;
+        if (ptrOffset(allocation->first, allocation->second->getUnderlyingBufferSize()) >= ptrOffset(buffer, size)) {
+            return allocation->second;
+        }
+    }
+    return nullptr;
+}
+
+void HostPtrAllocationCache::destroyEntry(NEO::GraphicsAllocation *allocation) {
+    entries.erase(allocation);
+    //allocation may still be referenced by a submission in flight
+    device.getNEODevice()->getMemoryManager()->checkGpuUsageAndDestroyGraphicsAllocations(allocation);
+}
+
+} // namespace L0
@@ -0,0 +1,51 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <unordered_map>
+
+namespace NEO {
+class GraphicsAllocation;
+} // namespace NEO
+
+namespace L0 {
+struct Device;
+
+//Shares userptr allocations only between command lists that reference the host memory at the same time.
+//Driver is not notified when application frees host memory, so an allocation is destroyed with its last
+//reference and host memory must stay allocated as long as any command list using it exists.
+class HostPtrAllocationCache {
+  public:
+    HostPtrAllocationCache(Device &device) : device(device) {}
+    ~HostPtrAllocationCache();
+
+    NEO::GraphicsAllocation *acquire(const void *buffer, size_t size);
+    bool release(NEO::GraphicsAllocation *allocation);
+
+    size_t getEntriesCount() const;
+
+  protected:
+    struct Entry {
+        const void *hostPtr = nullptr;
+        uint32_t refCount = 0u;
+        bool cacheable = false;
+    };
+
+    NEO::GraphicsAllocation *findCachedAllocation(const void *buffer, size_t size) const;
+    void destroyEntry(NEO::GraphicsAllocation *allocation);
+
+    Device &device;
+    std::unordered_map<NEO::GraphicsAllocation *, Entry> entries;
+    std::map<const void *, NEO::GraphicsAllocation *> rangeMap;
+    mutable std::mutex mtx;
+};
+
+} // namespace L0
@@ -12,6 +12,9 @@
 #include "level_zero/core/source/driver/driver_handle.h"
 #include "level_zero/core/source/get_extension_function_lookup_map.h"
 
+#include <map>
+#include <mutex>
+
 namespace L0 {
 
 struct DriverHandleImp : public DriverHandle {
@@ -61,6 +64,14 @@ struct DriverHandleImp : public DriverHandle {
                                                                      bool *allocationRangeCovered) override;
 
     uint32_t parseAffinityMask(std::vector<std::unique_ptr<NEO::Device>> &neoDevices);
+    size_t getIpcImportsCount();
+
+    //allocations imported through IPC handles, keyed by their address
+    struct IpcImport {
+        uint32_t refCount = 0u;
+    };
+    std::map<const void *, IpcImport> ipcImports;
+    std::mutex ipcImportsMutex;
 
     uint32_t numDevices = 0;
     std::unordered_map<std::string, void *> extensionFunctionsLookupMap;
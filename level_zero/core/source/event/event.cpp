@@ -14,6 +14,7 @@
 #include "shared/source/execution_environment/execution_environment.h"
 #include "shared/source/execution_environment/root_device_environment.h"
 #include "shared/source/helpers/constants.h"
+#include "shared/source/helpers/ptr_math.h"
 #include "shared/source/helpers/string.h"
 #include "shared/source/memory_manager/memory_manager.h"
 #include "shared/source/memory_manager/memory_operations_handler.h"
@@ -78,15 +79,26 @@ struct EventPoolImp : public EventPool {
     uint32_t getEventSize() override { return eventSize; }
     size_t getNumEvents() { return numEvents; }
 
+    ze_result_t hostSignalEvents(uint32_t startIndex, uint32_t count) override {
+        return hostSetEventsValue(startIndex, count, Event::STATE_SIGNALED);
+    }
+
+    ze_result_t resetEvents(uint32_t startIndex, uint32_t count) override {
+        return hostSetEventsValue(startIndex, count, Event::STATE_INITIAL);
+    }
+
     Device *getDevice() override { return device; }
 
     Device *device;
     size_t numEvents;
 
   protected:
-    const uint32_t eventSize = static_cast<uint32_t>(alignUp(sizeof(struct KernelTimestampEvent),
-                                                             MemoryConstants::cacheLineSize));
+    ze_result_t hostSetEventsValue(uint32_t startIndex, uint32_t count, uint32_t eventVal);
+
     const uint32_t eventAlignment = MemoryConstants::cacheLineSize;
+    //each event owns whole cachelines, so host writes to one event never share a line with its neighbours
+    const uint32_t eventSize = static_cast<uint32_t>(alignUp(sizeof(struct KernelTimestampEvent),
+                                                             eventAlignment));
 };
 
 Event *Event::create(EventPool *eventPool, const ze_event_desc_t *desc, Device *device) {
@@ -127,33 +139,38 @@ ze_result_t EventImp::queryStatus() {
     if (metricStreamer != nullptr) {
         *hostAddr = metricStreamer->getNotificationState();
     }
-    this->csr->downloadAllocations();
+    //only the event pool allocation is refreshed, so polling cost does not depend on the working set
+    this->csr->downloadAllocationIfPending(this->getAllocation());
     if (isTimestampEvent) {
         auto baseAddr = reinterpret_cast<uint64_t>(hostAddress);
         auto timeStampAddress = baseAddr + offsetof(KernelTimestampEvent, contextEnd);
         hostAddr = reinterpret_cast<uint64_t *>(timeStampAddress);
     }
     memcpy_s(static_cast<void *>(&queryVal), sizeof(uint32_t), static_cast<void *>(hostAddr), sizeof(uint32_t));
-    return queryVal == Event::STATE_CLEARED ? ZE_RESULT_NOT_READY : ZE_RESULT_SUCCESS;
+    if (queryVal == Event::STATE_CLEARED) {
+        //host is waiting, so work held back for coalescing must reach GPU
+        this->csr->flushCoalescedSubmissions();
+        return ZE_RESULT_NOT_READY;
+    }
+    //work signaling the event completed, so everything it wrote is made visible to host once
+    this->csr->downloadAllocations();
+    return ZE_RESULT_SUCCESS;
 }
 
 ze_result_t EventImp::hostEventSetValueTimestamps(uint32_t eventVal) {
-
-    auto baseAddr = reinterpret_cast<uint64_t>(hostAddress);
-    auto signalScopeFlag = this->signalScope;
-
-    auto eventTsSetFunc = [&](auto tsAddr) {
-        auto tsptr = reinterpret_cast<void *>(tsAddr);
-        memcpy_s(tsptr, sizeof(uint32_t), static_cast<void *>(&eventVal), sizeof(uint32_t));
-        if (!signalScopeFlag) {
-            NEO::CpuIntrinsics::clFlush(tsptr);
-        }
-    };
-
-    eventTsSetFunc(baseAddr + offsetof(KernelTimestampEvent, contextStart));
-    eventTsSetFunc(baseAddr + offsetof(KernelTimestampEvent, globalStart));
-    eventTsSetFunc(baseAddr + offsetof(KernelTimestampEvent, contextEnd));
-    eventTsSetFunc(baseAddr + offsetof(KernelTimestampEvent, globalEnd));
+    KernelTimestampEvent timestamps;
+    timestamps.contextStart = eventVal;
+    timestamps.globalStart = eventVal;
+    timestamps.contextEnd = eventVal;
+    timestamps.globalEnd = eventVal;
+
+    UNRECOVERABLE_IF(hostAddress == nullptr);
+    memcpy_s(hostAddress, sizeof(KernelTimestampEvent), static_cast<void *>(&timestamps), sizeof(KernelTimestampEvent));
+
+    //event slot is cacheline aligned, so all timestamps are flushed at once
+    if (!this->signalScope) {
+        NEO::CpuIntrinsics::clFlush(hostAddress);
+    }
 
     return ZE_RESULT_SUCCESS;
 }
@@ -257,6 +274,30 @@ EventPool *EventPool::create(DriverHandle *driver, uint32_t numDevices,
     return new EventPoolImp(driver, numDevices, phDevices, desc->count, desc->flags);
 }
 
+ze_result_t EventPoolImp::hostSetEventsValue(uint32_t startIndex, uint32_t count, uint32_t eventVal) {
+    if (count == 0u || startIndex >= numEvents || count > numEvents - startIndex) {
+        return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+
+    KernelTimestampEvent eventState;
+    eventState.contextStart = eventVal;
+    eventState.globalStart = eventVal;
+    eventState.contextEnd = eventVal;
+    eventState.globalEnd = eventVal;
+    size_t eventStateSize = isEventPoolUsedForTimestamp ? sizeof(KernelTimestampEvent) : sizeof(uint32_t);
+
+    auto eventSlot = ptrOffset(eventPoolAllocation->getUnderlyingBuffer(), static_cast<size_t>(startIndex) * eventSize);
+    for (uint32_t i = 0; i < count; i++) {
+        memcpy_s(eventSlot, eventStateSize, static_cast<void *>(&eventState), eventStateSize);
+        NEO::CpuIntrinsics::clFlush(eventSlot);
+        eventSlot = ptrOffset(eventSlot, eventSize);
+    }
+    //single fence orders all flushed slots before any later submission observes them
+    NEO::CpuIntrinsics::sfence();
+
+    return ZE_RESULT_SUCCESS;
+}
+
 ze_result_t EventPoolImp::getIpcHandle(ze_ipc_event_pool_handle_t *pIpcHandle) {
     return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 }
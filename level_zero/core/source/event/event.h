@@ -114,6 +114,9 @@ struct EventPool : _ze_event_pool_handle_t {
 
     virtual uint32_t getEventSize() = 0;
 
+    virtual ze_result_t hostSignalEvents(uint32_t startIndex, uint32_t count) = 0;
+    virtual ze_result_t resetEvents(uint32_t startIndex, uint32_t count) = 0;
+
     bool isEventPoolUsedForTimestamp = false;
 
   protected:
@@ -37,7 +37,13 @@ ze_result_t FenceImp::queryStatus() {
     }
 
     auto hostAddr = static_cast<uint64_t *>(allocation->getUnderlyingBuffer());
-    return *hostAddr == Fence::STATE_CLEARED ? ZE_RESULT_NOT_READY : ZE_RESULT_SUCCESS;
+    if (*hostAddr == Fence::STATE_CLEARED) {
+        if (csr) {
+            csr->flushCoalescedSubmissions();
+        }
+        return ZE_RESULT_NOT_READY;
+    }
+    return ZE_RESULT_SUCCESS;
 }
 
 void FenceImp::initialize() {
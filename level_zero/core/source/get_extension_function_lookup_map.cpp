@@ -7,9 +7,28 @@
 
 #include "level_zero/core/source/get_extension_function_lookup_map.h"
 
+#include "level_zero/core/source/cmdlist/cmdlist.h"
+#include "level_zero/core/source/event/event.h"
+
 namespace L0 {
 std::unordered_map<std::string, void *> getExtensionFunctionsLookupMap() {
-    return std::unordered_map<std::string, void *>();
+    std::unordered_map<std::string, void *> lookupMap;
+    lookupMap["zexCommandListUpdateKernelLaunchArguments"] = reinterpret_cast<void *>(zexCommandListUpdateKernelLaunchArguments);
+    lookupMap["zexEventPoolHostSignalEvents"] = reinterpret_cast<void *>(zexEventPoolHostSignalEvents);
+    lookupMap["zexEventPoolHostResetEvents"] = reinterpret_cast<void *>(zexEventPoolHostResetEvents);
+    return lookupMap;
+}
+
+ze_result_t ZE_APICALL zexCommandListUpdateKernelLaunchArguments(ze_command_list_handle_t hCommandList, uint32_t launchIndex, ze_kernel_handle_t hKernel) {
+    return CommandList::fromHandle(hCommandList)->updateKernelLaunchArguments(launchIndex, hKernel);
+}
+
+ze_result_t ZE_APICALL zexEventPoolHostSignalEvents(ze_event_pool_handle_t hEventPool, uint32_t startIndex, uint32_t count) {
+    return EventPool::fromHandle(hEventPool)->hostSignalEvents(startIndex, count);
+}
+
+ze_result_t ZE_APICALL zexEventPoolHostResetEvents(ze_event_pool_handle_t hEventPool, uint32_t startIndex, uint32_t count) {
+    return EventPool::fromHandle(hEventPool)->resetEvents(startIndex, count);
 }
 
-} // namespace L0
\ No newline at end of file
+} // namespace L0
@@ -5,9 +5,21 @@
  *
  */
 
+#pragma once
+#include <level_zero/ze_api.h>
+
 #include <string>
 #include <unordered_map>
 
 namespace L0 {
 std::unordered_map<std::string, void *> getExtensionFunctionsLookupMap();
-} // namespace L0
\ No newline at end of file
+
+//copies current arguments of hKernel over the payload of launch launchIndex recorded in hCommandList,
+//the list must not be executing; ZE_RESULT_ERROR_NOT_AVAILABLE is returned while a submission of it is in flight
+ze_result_t ZE_APICALL zexCommandListUpdateKernelLaunchArguments(ze_command_list_handle_t hCommandList, uint32_t launchIndex, ze_kernel_handle_t hKernel);
+
+//signals or resets count events of hEventPool starting at index startIndex from the host with a single memory fence,
+//ZE_RESULT_ERROR_INVALID_ARGUMENT is returned when the range is empty or exceeds the pool
+ze_result_t ZE_APICALL zexEventPoolHostSignalEvents(ze_event_pool_handle_t hEventPool, uint32_t startIndex, uint32_t count);
+ze_result_t ZE_APICALL zexEventPoolHostResetEvents(ze_event_pool_handle_t hEventPool, uint32_t startIndex, uint32_t count);
+} // namespace L0
@@ -10,6 +10,7 @@
 #include "shared/source/kernel/dispatch_kernel_encoder_interface.h"
 #include "shared/source/kernel/kernel_descriptor.h"
 #include "shared/source/memory_manager/graphics_allocation.h"
+#include "shared/source/memory_manager/isa_pool_allocator.h"
 #include "shared/source/unified_memory/unified_memory.h"
 
 #include <level_zero/ze_api.h>
@@ -37,6 +38,10 @@ struct KernelImmutableData {
                     uint32_t computeUnitsUsedForSratch,
                     NEO::GraphicsAllocation *globalConstBuffer, NEO::GraphicsAllocation *globalVarBuffer);
 
+    //descriptor is available for queries before ISA and templates are created on first use
+    void initializeDescriptor(NEO::KernelInfo *kernelInfo) { this->kernelDescriptor = &kernelInfo->kernelDescriptor; }
+    bool isInitialized() const { return getIsaGraphicsAllocation() != nullptr; }
+
     const std::vector<NEO::GraphicsAllocation *> &getResidencyContainer() const {
         return residencyContainer;
     }
@@ -46,7 +51,12 @@ struct KernelImmutableData {
     }
 
     uint32_t getIsaSize() const;
-    NEO::GraphicsAllocation *getIsaGraphicsAllocation() const { return isaGraphicsAllocation.get(); }
+    NEO::GraphicsAllocation *getIsaGraphicsAllocation() const {
+        return sharedIsaAllocation ? sharedIsaAllocation->getGraphicsAllocation() : isaGraphicsAllocation.get();
+    }
+    uint64_t getIsaOffsetInParentAllocation() const {
+        return sharedIsaAllocation ? sharedIsaAllocation->getOffset() : 0u;
+    }
 
     uint64_t getPrivateMemorySize() const;
     NEO::GraphicsAllocation *getPrivateMemoryGraphicsAllocation() const { return privateMemoryGraphicsAllocation.get(); }
@@ -67,6 +77,8 @@ struct KernelImmutableData {
     Device *device = nullptr;
     NEO::KernelDescriptor *kernelDescriptor = nullptr;
     std::unique_ptr<NEO::GraphicsAllocation> isaGraphicsAllocation = nullptr;
+    //ISA packed with other kernels of the device in a pool allocation
+    NEO::SharedIsaAllocation *sharedIsaAllocation = nullptr;
     std::unique_ptr<NEO::GraphicsAllocation> privateMemoryGraphicsAllocation = nullptr;
 
     uint32_t crossThreadDataSize = 0;
@@ -105,17 +105,19 @@ struct KernelHw : public KernelImp {
             cloned->dynamicStateHeapDataSize = this->dynamicStateHeapDataSize;
         }
 
-        if (this->perThreadDataForWholeThreadGroup != nullptr) {
-            alignedFree(cloned->perThreadDataForWholeThreadGroup);
-            cloned->perThreadDataForWholeThreadGroup = reinterpret_cast<uint8_t *>(alignedMalloc(perThreadDataSizeForWholeThreadGroupAllocated, 32));
-            memcpy_s(cloned->perThreadDataForWholeThreadGroup,
-                     this->perThreadDataSizeForWholeThreadGroupAllocated,
-                     this->perThreadDataForWholeThreadGroup,
-                     this->perThreadDataSizeForWholeThreadGroupAllocated);
-            cloned->perThreadDataSizeForWholeThreadGroupAllocated = this->perThreadDataSizeForWholeThreadGroupAllocated;
-            cloned->perThreadDataSizeForWholeThreadGroup = this->perThreadDataSizeForWholeThreadGroup;
-            cloned->perThreadDataSize = this->perThreadDataSize;
+        for (auto &entry : this->localIdsCache) {
+            auto clonedEntry = entry;
+            clonedEntry.perThreadData = reinterpret_cast<uint8_t *>(alignedMalloc(entry.perThreadDataSizeAllocated, 32));
+            memcpy_s(clonedEntry.perThreadData, clonedEntry.perThreadDataSizeAllocated,
+                     entry.perThreadData, entry.perThreadDataSizeAllocated);
+            if (entry.perThreadData == this->perThreadDataForWholeThreadGroup) {
+                cloned->perThreadDataForWholeThreadGroup = clonedEntry.perThreadData;
+            }
+            cloned->localIdsCache.push_back(clonedEntry);
         }
+        cloned->localIdsCacheUseCounter = this->localIdsCacheUseCounter;
+        cloned->perThreadDataSizeForWholeThreadGroup = this->perThreadDataSizeForWholeThreadGroup;
+        cloned->perThreadDataSize = this->perThreadDataSize;
 
         return ret;
     }
@@ -28,6 +28,7 @@
 #include "level_zero/core/source/printf_handler/printf_handler.h"
 #include "level_zero/core/source/sampler/sampler.h"
 
+#include <algorithm>
 #include <memory>
 
 namespace L0 {
@@ -64,6 +65,10 @@ inline SamplerPatchValues getAddrMode(ze_sampler_address_mode_t addressingMode)
 KernelImmutableData::KernelImmutableData(L0::Device *l0device) : device(l0device) {}
 
 KernelImmutableData::~KernelImmutableData() {
+    if (nullptr != sharedIsaAllocation) {
+        this->getDevice()->getNEODevice()->getIsaPoolAllocator()->freeAllocation(sharedIsaAllocation);
+        sharedIsaAllocation = nullptr;
+    }
     if (nullptr != isaGraphicsAllocation) {
         this->getDevice()->getNEODevice()->getMemoryManager()->freeGraphicsMemory(&*isaGraphicsAllocation);
         isaGraphicsAllocation.release();
@@ -102,20 +107,20 @@ void KernelImmutableData::initialize(NEO::KernelInfo *kernelInfo, NEO::MemoryMan
 
     auto kernelIsaSize = kernelInfo->heapInfo.KernelHeapSize;
 
-    auto allocation = memoryManager.allocateGraphicsMemoryWithProperties(
-        {device->getRootDeviceIndex(), kernelIsaSize, NEO::GraphicsAllocation::AllocationType::KERNEL_ISA, device->getDeviceBitfield()});
-    UNRECOVERABLE_IF(allocation == nullptr);
+    auto isaAllocation = device->getIsaPoolAllocator()->requestAllocation(kernelIsaSize);
+    UNRECOVERABLE_IF(isaAllocation == nullptr);
+    auto allocation = isaAllocation->getGraphicsAllocation();
 
     auto &hwInfo = device->getHardwareInfo();
     auto &hwHelper = NEO::HwHelper::get(hwInfo.platform.eRenderCoreFamily);
 
     if (kernelInfo->heapInfo.pKernelHeap != nullptr) {
         NEO::MemoryTransferHelper::transferMemoryToAllocation(hwHelper.isBlitCopyRequiredForLocalMemory(hwInfo, *allocation),
-                                                              *device, allocation, 0, kernelInfo->heapInfo.pKernelHeap,
+                                                              *device, allocation, isaAllocation->getOffset(), kernelInfo->heapInfo.pKernelHeap,
                                                               static_cast<size_t>(kernelIsaSize));
     }
 
-    isaGraphicsAllocation.reset(allocation);
+    sharedIsaAllocation = isaAllocation;
 
     this->crossThreadDataSize = this->kernelDescriptor->kernelAttributes.crossThreadDataSize;
 
@@ -188,6 +193,9 @@ void KernelImmutableData::initialize(NEO::KernelInfo *kernelInfo, NEO::MemoryMan
 }
 
 uint32_t KernelImmutableData::getIsaSize() const {
+    if (sharedIsaAllocation) {
+        return static_cast<uint32_t>(sharedIsaAllocation->getSize());
+    }
     return static_cast<uint32_t>(isaGraphicsAllocation->getUnderlyingBufferSize());
 }
 
@@ -202,9 +210,10 @@ uint64_t KernelImmutableData::getPrivateMemorySize() const {
 KernelImp::KernelImp(Module *module) : module(module) {}
 
 KernelImp::~KernelImp() {
-    if (perThreadDataForWholeThreadGroup != nullptr) {
-        alignedFree(perThreadDataForWholeThreadGroup);
+    for (auto &entry : localIdsCache) {
+        alignedFree(entry.perThreadData);
     }
+    localIdsCache.clear();
     if (printfBuffer != nullptr) {
         module->getDevice()->getNEODevice()->getMemoryManager()->freeGraphicsMemory(printfBuffer);
     }
@@ -239,6 +248,11 @@ ze_result_t KernelImp::setGroupSize(uint32_t groupSizeX, uint32_t groupSizeY,
         return ZE_RESULT_ERROR_INVALID_ARGUMENT;
     }
 
+    if ((groupSizeX == this->groupSize[0]) && (groupSizeY == this->groupSize[1]) && (groupSizeZ == this->groupSize[2])) {
+        //cross-thread data and local IDs already match this group size
+        return ZE_RESULT_SUCCESS;
+    }
+
     auto numChannels = kernelImmData->getDescriptor().kernelAttributes.numLocalIdChannels;
     Vec3<size_t> groupSize{groupSizeX, groupSizeY, groupSizeZ};
     auto itemsInGroup = Math::computeTotalElementsCount(groupSize);
@@ -269,24 +283,12 @@ ze_result_t KernelImp::setGroupSize(uint32_t groupSizeX, uint32_t groupSizeY,
         uint32_t perThreadDataSizeForWholeThreadGroupNeeded =
             static_cast<uint32_t>(NEO::PerThreadDataHelper::getPerThreadDataSizeTotal(
                 simdSize, grfSize, numChannels, itemsInGroup));
-        if (perThreadDataSizeForWholeThreadGroupNeeded >
-            perThreadDataSizeForWholeThreadGroupAllocated) {
-            alignedFree(perThreadDataForWholeThreadGroup);
-            perThreadDataForWholeThreadGroup = static_cast<uint8_t *>(alignedMalloc(perThreadDataSizeForWholeThreadGroupNeeded, 32));
-            perThreadDataSizeForWholeThreadGroupAllocated = perThreadDataSizeForWholeThreadGroupNeeded;
-        }
         perThreadDataSizeForWholeThreadGroup = perThreadDataSizeForWholeThreadGroupNeeded;
 
         if (numChannels > 0) {
             UNRECOVERABLE_IF(3 != numChannels);
-            NEO::generateLocalIDs(
-                perThreadDataForWholeThreadGroup,
-                static_cast<uint16_t>(simdSize),
-                std::array<uint16_t, 3>{{static_cast<uint16_t>(groupSizeX),
-                                         static_cast<uint16_t>(groupSizeY),
-                                         static_cast<uint16_t>(groupSizeZ)}},
-                std::array<uint8_t, 3>{{0, 1, 2}},
-                false, grfSize);
+            perThreadDataForWholeThreadGroup = getLocalIds(simdSize, grfSize, std::array<uint8_t, 3>{{0, 1, 2}},
+                                                           perThreadDataSizeForWholeThreadGroupNeeded);
         }
 
         this->perThreadDataSize = perThreadDataSizeForWholeThreadGroup / numThreadsPerThreadGroup;
@@ -294,6 +296,47 @@ ze_result_t KernelImp::setGroupSize(uint32_t groupSizeX, uint32_t groupSizeY,
     return ZE_RESULT_SUCCESS;
 }
 
+uint8_t *KernelImp::getLocalIds(uint32_t simdSize, uint32_t grfSize, const std::array<uint8_t, 3> &dimensionsOrder,
+                                uint32_t perThreadDataSizeNeeded) {
+    for (auto &entry : localIdsCache) {
+        if (std::equal(entry.groupSize, entry.groupSize + 3, this->groupSize) && entry.simdSize == simdSize &&
+            entry.grfSize == grfSize && entry.dimensionsOrder == dimensionsOrder) {
+            entry.lastUse = ++localIdsCacheUseCounter;
+            return entry.perThreadData;
+        }
+    }
+
+    LocalIdsCacheEntry *entry = nullptr;
+    if (localIdsCache.size() < localIdsCacheSize) {
+        localIdsCache.emplace_back();
+        entry = &localIdsCache.back();
+    } else {
+        entry = &*std::min_element(localIdsCache.begin(), localIdsCache.end(),
+                                   [](const LocalIdsCacheEntry &lhs, const LocalIdsCacheEntry &rhs) { return lhs.lastUse < rhs.lastUse; });
+    }
+
+    if (perThreadDataSizeNeeded > entry->perThreadDataSizeAllocated) {
+        alignedFree(entry->perThreadData);
+        entry->perThreadData = static_cast<uint8_t *>(alignedMalloc(perThreadDataSizeNeeded, 32));
+        entry->perThreadDataSizeAllocated = perThreadDataSizeNeeded;
+    }
+    std::copy(this->groupSize, this->groupSize + 3, entry->groupSize);
+    entry->simdSize = simdSize;
+    entry->grfSize = grfSize;
+    entry->dimensionsOrder = dimensionsOrder;
+    entry->lastUse = ++localIdsCacheUseCounter;
+
+    NEO::generateLocalIDs(
+        entry->perThreadData,
+        static_cast<uint16_t>(simdSize),
+        std::array<uint16_t, 3>{{static_cast<uint16_t>(this->groupSize[0]),
+                                 static_cast<uint16_t>(this->groupSize[1]),
+                                 static_cast<uint16_t>(this->groupSize[2])}},
+        dimensionsOrder,
+        false, grfSize);
+    return entry->perThreadData;
+}
+
 ze_result_t KernelImp::suggestGroupSize(uint32_t globalSizeX, uint32_t globalSizeY,
                                         uint32_t globalSizeZ, uint32_t *groupSizeX,
                                         uint32_t *groupSizeY, uint32_t *groupSizeZ) {
@@ -758,4 +801,8 @@ NEO::GraphicsAllocation *KernelImp::getIsaAllocation() const {
     return getImmutableData()->getIsaGraphicsAllocation();
 }
 
+uint64_t KernelImp::getIsaOffsetInParentAllocation() const {
+    return getImmutableData()->getIsaOffsetInParentAllocation();
+}
+
 } // namespace L0
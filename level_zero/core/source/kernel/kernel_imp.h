@@ -12,7 +12,9 @@
 
 #include "level_zero/core/source/kernel/kernel.h"
 
+#include <array>
 #include <memory>
+#include <vector>
 
 namespace L0 {
 
@@ -104,14 +106,27 @@ struct KernelImp : Kernel {
     }
     uint32_t getSlmTotalSize() const override;
     NEO::GraphicsAllocation *getIsaAllocation() const override;
+    uint64_t getIsaOffsetInParentAllocation() const override;
 
     uint32_t getRequiredWorkgroupOrder() const override { return requiredWorkgroupOrder; }
     bool requiresGenerationOfLocalIdsByRuntime() const override { return kernelRequiresGenerationOfLocalIdsByRuntime; }
 
   protected:
+    struct LocalIdsCacheEntry {
+        uint32_t groupSize[3] = {0u, 0u, 0u};
+        uint32_t simdSize = 0u;
+        uint32_t grfSize = 0u;
+        std::array<uint8_t, 3> dimensionsOrder = {{0, 1, 2}};
+        uint8_t *perThreadData = nullptr;
+        uint32_t perThreadDataSizeAllocated = 0u;
+        uint64_t lastUse = 0u;
+    };
+    static constexpr size_t localIdsCacheSize = 4u;
+
     KernelImp() = default;
 
     void patchWorkgroupSizeInCrossThreadData(uint32_t x, uint32_t y, uint32_t z);
+    uint8_t *getLocalIds(uint32_t simdSize, uint32_t grfSize, const std::array<uint8_t, 3> &dimensionsOrder, uint32_t perThreadDataSizeNeeded);
 
     void createPrintfBuffer();
     void setDebugSurface();
@@ -139,8 +154,10 @@ struct KernelImp : Kernel {
     std::unique_ptr<uint8_t[]> dynamicStateHeapData = nullptr;
     uint32_t dynamicStateHeapDataSize = 0;
 
+    //points into localIdsCache, which owns the generated local IDs of recently used group sizes
     uint8_t *perThreadDataForWholeThreadGroup = nullptr;
-    uint32_t perThreadDataSizeForWholeThreadGroupAllocated = 0;
+    std::vector<LocalIdsCacheEntry> localIdsCache;
+    uint64_t localIdsCacheUseCounter = 0u;
     uint32_t perThreadDataSizeForWholeThreadGroup = 0u;
     uint32_t perThreadDataSize = 0u;
 
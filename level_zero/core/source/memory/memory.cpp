@@ -31,6 +31,9 @@ ze_result_t DriverHandleImp::openIpcMemHandle(ze_device_handle_t hDevice, ze_ipc
                                               ze_ipc_memory_flag_t flags, void **ptr) {
     auto neoDevice = Device::fromHandle(hDevice)->getNEODevice();
     uint64_t handle = *(pIpcHandle.data);
+
+    //handle values are fd numbers reused by the kernel after close, so imports are matched by the buffer object they resolve to
+    std::lock_guard<std::mutex> lock(ipcImportsMutex);
     NEO::osHandle osHandle = static_cast<NEO::osHandle>(handle);
     NEO::AllocationProperties unifiedMemoryProperties{neoDevice->getRootDeviceIndex(),
                                                       MemoryConstants::pageSize,
@@ -44,24 +47,54 @@ ze_result_t DriverHandleImp::openIpcMemHandle(ze_device_handle_t hDevice, ze_ipc
         return ZE_RESULT_ERROR_INVALID_ARGUMENT;
     }
 
-    NEO::SvmAllocationData allocData(neoDevice->getRootDeviceIndex());
-    allocData.gpuAllocations.addAllocation(alloc);
-    allocData.cpuAllocation = nullptr;
-    allocData.size = alloc->getUnderlyingBufferSize();
-    allocData.memoryType = InternalMemoryType::DEVICE_UNIFIED_MEMORY;
-    allocData.device = neoDevice;
+    auto importPtr = reinterpret_cast<void *>(alloc->getGpuAddress());
+    auto import = ipcImports.find(importPtr);
+    if (import != ipcImports.end()) {
+        //another handle of an already imported buffer object resolves to the existing mapping
+        this->getMemoryManager()->freeGraphicsMemory(alloc);
+    } else {
+        NEO::SvmAllocationData allocData(neoDevice->getRootDeviceIndex());
+        allocData.gpuAllocations.addAllocation(alloc);
+        allocData.cpuAllocation = nullptr;
+        allocData.size = alloc->getUnderlyingBufferSize();
+        allocData.memoryType = InternalMemoryType::DEVICE_UNIFIED_MEMORY;
+        allocData.device = neoDevice;
+
+        this->getSvmAllocsManager()->insertSVMAlloc(allocData);
+        import = ipcImports.insert({importPtr, IpcImport{}}).first;
+    }
 
-    this->getSvmAllocsManager()->insertSVMAlloc(allocData);
+    import->second.refCount++;
 
-    *ptr = reinterpret_cast<void *>(alloc->getGpuAddress());
+    *ptr = importPtr;
 
     return ZE_RESULT_SUCCESS;
 }
 
 ze_result_t DriverHandleImp::closeIpcMemHandle(const void *ptr) {
+    std::unique_lock<std::mutex> lock(ipcImportsMutex);
+    auto import = ipcImports.find(ptr);
+    if (import == ipcImports.end()) {
+        return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+
+    import->second.refCount--;
+    if (import->second.refCount > 0u) {
+        return ZE_RESULT_SUCCESS;
+    }
+
+    ipcImports.erase(import);
+    lock.unlock();
+
+    svmAllocsManager->freeSVMAlloc(const_cast<void *>(ptr));
     return ZE_RESULT_SUCCESS;
 }
 
+size_t DriverHandleImp::getIpcImportsCount() {
+    std::lock_guard<std::mutex> lock(ipcImportsMutex);
+    return ipcImports.size();
+}
+
 ze_result_t DriverHandleImp::checkMemoryAccessFromDevice(Device *device, const void *ptr) {
     auto allocation = svmAllocsManager->getSVMAlloc(ptr);
     if (allocation == nullptr) {
@@ -177,6 +210,14 @@ ze_result_t DriverHandleImp::freeMem(const void *ptr) {
     if (allocation == nullptr) {
         return ZE_RESULT_ERROR_INVALID_ARGUMENT;
     }
+    {
+        //imported memory is shared by all opens of its handles, so freeing it drops one reference
+        std::unique_lock<std::mutex> lock(ipcImportsMutex);
+        if (ipcImports.find(ptr) != ipcImports.end()) {
+            lock.unlock();
+            return closeIpcMemHandle(ptr);
+        }
+    }
     svmAllocsManager->freeSVMAlloc(const_cast<void *>(ptr));
     if (svmAllocsManager->getSvmMapOperation(ptr)) {
         svmAllocsManager->removeSvmMapOperation(ptr);
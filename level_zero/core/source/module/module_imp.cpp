@@ -8,6 +8,7 @@
 #include "level_zero/core/source/module/module_imp.h"
 
 #include "shared/source/compiler_interface/intermediate_representations.h"
+#include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/device/device.h"
 #include "shared/source/device_binary_format/device_binary_formats.h"
 #include "shared/source/helpers/string.h"
@@ -333,13 +334,22 @@ bool ModuleImp::initialize(const ze_module_desc_t *desc, NEO::Device *neoDevice)
         return false;
     }
 
-    kernelImmDatas.reserve(this->translationUnit->programInfo.kernelInfos.size());
-    for (auto &ki : this->translationUnit->programInfo.kernelInfos) {
+    //exported functions segment is the target of relocations, so its ISA must exist before linking
+    int32_t exportedFunctionsSegmentId = -1;
+    if (this->translationUnit->programInfo.linkerInput) {
+        exportedFunctionsSegmentId = this->translationUnit->programInfo.linkerInput->getExportedFunctionsSegmentId();
+    }
+    bool lazyInitialization = NEO::DebugManager.flags.EnableLazyKernelInitialization.get() && !debugEnabled;
+
+    auto &kernelInfos = this->translationUnit->programInfo.kernelInfos;
+    kernelImmDatas.reserve(kernelInfos.size());
+    for (size_t i = 0; i < kernelInfos.size(); i++) {
         std::unique_ptr<KernelImmutableData> kernelImmData{new KernelImmutableData(this->device)};
-        kernelImmData->initialize(ki, *(device->getNEODevice()->getMemoryManager()),
-                                  device->getNEODevice(),
-                                  device->getNEODevice()->getDeviceInfo().computeUnitsUsedForScratch,
-                                  this->translationUnit->globalConstBuffer, this->translationUnit->globalVarBuffer);
+        if (lazyInitialization && static_cast<int32_t>(i) != exportedFunctionsSegmentId) {
+            kernelImmData->initializeDescriptor(kernelInfos[i]);
+        } else {
+            initializeKernelImmutableData(*kernelImmData, i);
+        }
         kernelImmDatas.push_back(std::move(kernelImmData));
     }
     this->maxGroupSize = static_cast<uint32_t>(this->translationUnit->device->getNEODevice()->getDeviceInfo().maxWorkGroupSize);
@@ -350,12 +360,30 @@ bool ModuleImp::initialize(const ze_module_desc_t *desc, NEO::Device *neoDevice)
 const KernelImmutableData *ModuleImp::getKernelImmutableData(const char *functionName) const {
     for (auto &kernelImmData : kernelImmDatas) {
         if (kernelImmData->getDescriptor().kernelMetadata.kernelName.compare(functionName) == 0) {
+            std::lock_guard<std::mutex> lock(kernelImmDatasMutex);
+            if (false == kernelImmData->isInitialized()) {
+                initializeKernelImmutableData(*kernelImmData, &kernelImmData - &kernelImmDatas[0]);
+            }
             return kernelImmData.get();
         }
     }
     return nullptr;
 }
 
+void ModuleImp::initializeKernelImmutableData(KernelImmutableData &kernelImmData, size_t kernelId) const {
+    auto neoDevice = device->getNEODevice();
+    kernelImmData.initialize(this->translationUnit->programInfo.kernelInfos[kernelId], *(neoDevice->getMemoryManager()),
+                             neoDevice,
+                             neoDevice->getDeviceInfo().computeUnitsUsedForScratch,
+                             this->translationUnit->globalConstBuffer, this->translationUnit->globalVarBuffer);
+
+    if (kernelId < patchedIsaSegments.size() && false == patchedIsaSegments[kernelId].empty()) {
+        neoDevice->getMemoryManager()->copyMemoryToAllocation(kernelImmData.getIsaGraphicsAllocation(), kernelImmData.getIsaOffsetInParentAllocation(),
+                                                              patchedIsaSegments[kernelId].data(),
+                                                              patchedIsaSegments[kernelId].size());
+    }
+}
+
 void ModuleImp::createBuildOptions(const char *pBuildFlags, std::string &apiOptions, std::string &internalBuildOptions) {
     if (pBuildFlags != nullptr) {
         std::string buildFlags(pBuildFlags);
@@ -413,12 +441,16 @@ ze_result_t ModuleImp::getDebugInfo(size_t *pDebugDataSize, uint8_t *pDebugData)
 
 void ModuleImp::copyPatchedSegments(const NEO::Linker::PatchableSegments &isaSegmentsForPatching) {
     if (this->translationUnit->programInfo.linkerInput && this->translationUnit->programInfo.linkerInput->getTraits().requiresPatchingOfInstructionSegments) {
+        patchedIsaSegments.resize(this->kernelImmDatas.size());
         for (const auto &kernelImmData : this->kernelImmDatas) {
+            auto segmentId = &kernelImmData - &this->kernelImmDatas[0];
             if (nullptr == kernelImmData->getIsaGraphicsAllocation()) {
+                auto patchedIsa = reinterpret_cast<const char *>(isaSegmentsForPatching[segmentId].hostPointer);
+                patchedIsaSegments[segmentId].assign(patchedIsa, patchedIsa + isaSegmentsForPatching[segmentId].segmentSize);
                 continue;
             }
-            auto segmentId = &kernelImmData - &this->kernelImmDatas[0];
-            this->device->getDriverHandle()->getMemoryManager()->copyMemoryToAllocation(kernelImmData->getIsaGraphicsAllocation(), 0,
+            this->device->getDriverHandle()->getMemoryManager()->copyMemoryToAllocation(kernelImmData->getIsaGraphicsAllocation(),
+                                                                                        kernelImmData->getIsaOffsetInParentAllocation(),
                                                                                         isaSegmentsForPatching[segmentId].hostPointer,
                                                                                         isaSegmentsForPatching[segmentId].segmentSize);
         }
@@ -447,9 +479,10 @@ bool ModuleImp::linkBinary() {
     }
     if (this->translationUnit->programInfo.linkerInput->getExportedFunctionsSegmentId() >= 0) {
         auto exportedFunctionHeapId = this->translationUnit->programInfo.linkerInput->getExportedFunctionsSegmentId();
-        this->exportedFunctionsSurface = this->kernelImmDatas[exportedFunctionHeapId]->getIsaGraphicsAllocation();
-        exportedFunctions.gpuAddress = static_cast<uintptr_t>(exportedFunctionsSurface->getGpuAddressToPatch());
-        exportedFunctions.segmentSize = exportedFunctionsSurface->getUnderlyingBufferSize();
+        auto &exportedFunctionsImmData = this->kernelImmDatas[exportedFunctionHeapId];
+        this->exportedFunctionsSurface = exportedFunctionsImmData->getIsaGraphicsAllocation();
+        exportedFunctions.gpuAddress = static_cast<uintptr_t>(exportedFunctionsSurface->getGpuAddressToPatch() + exportedFunctionsImmData->getIsaOffsetInParentAllocation());
+        exportedFunctions.segmentSize = exportedFunctionsImmData->getIsaSize();
     }
     Linker::PatchableSegments isaSegmentsForPatching;
     std::vector<std::vector<char>> patchedIsaTempStorage;
@@ -18,6 +18,7 @@
 #include "igfxfmid.h"
 
 #include <memory>
+#include <mutex>
 #include <string>
 
 namespace L0 {
@@ -116,6 +117,7 @@ struct ModuleImp : public Module {
 
   protected:
     void copyPatchedSegments(const NEO::Linker::PatchableSegments &isaSegmentsForPatching);
+    void initializeKernelImmutableData(KernelImmutableData &kernelImmData, size_t kernelId) const;
     void verifyDebugCapabilities();
     Device *device = nullptr;
     PRODUCT_FAMILY productFamily{};
@@ -124,6 +126,9 @@ struct ModuleImp : public Module {
     NEO::GraphicsAllocation *exportedFunctionsSurface = nullptr;
     uint32_t maxGroupSize = 0U;
     std::vector<std::unique_ptr<KernelImmutableData>> kernelImmDatas;
+    mutable std::mutex kernelImmDatasMutex;
+    //relocated ISA of kernels not created yet, uploaded when the kernel is first created
+    std::vector<std::vector<char>> patchedIsaSegments;
     NEO::Linker::RelocatedSymbolsMap symbols;
     bool debugEnabled = false;
     bool isFullyLinked = false;
@@ -305,6 +305,10 @@ struct MockCommandList : public CommandList {
                      (void *dstPtr,
                       uint64_t value));
 
+    ADDMETHOD_NOBASE(updateKernelLaunchArguments, ze_result_t, ZE_RESULT_SUCCESS,
+                     (uint32_t launchIndex,
+                      ze_kernel_handle_t hKernel));
+
     ADDMETHOD_NOBASE(executeCommandListImmediate, ze_result_t, ZE_RESULT_SUCCESS,
                      (bool perforMigration));
 
@@ -256,6 +256,10 @@ struct Mock<Device> : public Device {
         return ZE_RESULT_SUCCESS;
     }
 
+    HostPtrAllocationCache *getHostPtrAllocationCache() override {
+        return nullptr;
+    }
+
     ze_result_t mapOrdinalForAvailableEngineGroup(uint32_t *ordinal) override {
         return ZE_RESULT_SUCCESS;
     }
@@ -73,6 +73,8 @@ struct Mock<EventPool> : public EventPool {
     MOCK_METHOD1(releaseEventToPool, ze_result_t(::L0::Event *event));
     MOCK_METHOD0(getDevice, Device *());
     MOCK_METHOD0(getEventSize, uint32_t());
+    MOCK_METHOD2(hostSignalEvents, ze_result_t(uint32_t startIndex, uint32_t count));
+    MOCK_METHOD2(resetEvents, ze_result_t(uint32_t startIndex, uint32_t count));
 
     std::vector<int> pool;
 
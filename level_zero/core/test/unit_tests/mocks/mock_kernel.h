@@ -42,6 +42,8 @@ struct WhiteBox<::L0::Kernel> : public ::L0::KernelImp {
     using ::L0::KernelImp::groupSize;
     using ::L0::KernelImp::kernelImmData;
     using ::L0::KernelImp::kernelRequiresGenerationOfLocalIdsByRuntime;
+    using ::L0::KernelImp::localIdsCache;
+    using ::L0::KernelImp::localIdsCacheSize;
     using ::L0::KernelImp::module;
     using ::L0::KernelImp::numThreadsPerThreadGroup;
     using ::L0::KernelImp::perThreadDataForWholeThreadGroup;
@@ -50,6 +52,7 @@ struct WhiteBox<::L0::Kernel> : public ::L0::KernelImp {
     using ::L0::KernelImp::printfBuffer;
     using ::L0::KernelImp::requiredWorkgroupOrder;
     using ::L0::KernelImp::residencyContainer;
+    using ::L0::KernelImp::slmArgsTotalSize;
     using ::L0::KernelImp::unifiedMemoryControls;
 
     void setBufferSurfaceState(uint32_t argIndex, void *address,
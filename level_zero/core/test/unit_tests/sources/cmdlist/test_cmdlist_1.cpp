@@ -6,9 +6,12 @@
  */
 
 #include "shared/source/gmm_helper/gmm_helper.h"
+#include "shared/source/helpers/options.h"
 #include "shared/source/helpers/register_offsets.h"
+#include "shared/source/memory_manager/internal_allocation_storage.h"
 #include "shared/test/unit_test/cmd_parse/gen_cmd_parse.h"
 
+#include "opencl/test/unit_test/libult/ult_command_stream_receiver.h"
 #include "opencl/test/unit_test/mocks/mock_graphics_allocation.h"
 #include "test.h"
 
@@ -18,6 +21,7 @@
 #include "level_zero/core/test/unit_tests/fixtures/device_fixture.h"
 #include "level_zero/core/test/unit_tests/mocks/mock_cmdlist.h"
 #include "level_zero/core/test/unit_tests/mocks/mock_event.h"
+#include "level_zero/core/test/unit_tests/mocks/mock_kernel.h"
 
 namespace L0 {
 namespace ult {
@@ -274,6 +278,77 @@ TEST_F(CommandListCreate, givenQueueDescriptionwhenCreatingImmediateCommandListF
     }
 }
 
+HWTEST_F(CommandListCreate, givenSynchronousImmediateCommandListWhenAppendingBarrierThenCsrIsWaitedForSubmittedTaskCount) {
+    ze_command_queue_desc_t desc = {};
+    desc.mode = ZE_COMMAND_QUEUE_MODE_SYNCHRONOUS;
+    ze_result_t returnValue;
+    std::unique_ptr<L0::CommandList> commandList(CommandList::createImmediate(productFamily, device, &desc, false, NEO::EngineGroupType::RenderCompute, returnValue));
+    ASSERT_NE(nullptr, commandList);
+
+    auto csr = static_cast<NEO::UltCommandStreamReceiver<FamilyType> *>(static_cast<CommandQueueImp *>(commandList->cmdQImmediate)->getCsr());
+    csr->latestWaitForCompletionWithTimeoutTaskCount = 0u;
+
+    auto result = commandList->appendBarrier(nullptr, 0, nullptr);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+    EXPECT_EQ(csr->peekTaskCount(), csr->latestWaitForCompletionWithTimeoutTaskCount.load());
+}
+
+HWTEST_F(CommandListCreate, givenAsynchronousImmediateCommandListWhenAppendingBarrierThenCsrIsNotWaitedAndSubmittedBuffersAreHandedOverToCsr) {
+    ze_command_queue_desc_t desc = {};
+    desc.mode = ZE_COMMAND_QUEUE_MODE_ASYNCHRONOUS;
+    ze_result_t returnValue;
+    std::unique_ptr<L0::CommandList> commandList(CommandList::createImmediate(productFamily, device, &desc, false, NEO::EngineGroupType::RenderCompute, returnValue));
+    ASSERT_NE(nullptr, commandList);
+
+    auto csr = static_cast<NEO::UltCommandStreamReceiver<FamilyType> *>(static_cast<CommandQueueImp *>(commandList->cmdQImmediate)->getCsr());
+    csr->latestWaitForCompletionWithTimeoutTaskCount = 0u;
+    *csr->getTagAddress() = 0u;
+
+    auto submittedCmdBuffer = commandList->commandContainer.getCmdBufferAllocations()[0];
+    auto submittedSsh = commandList->commandContainer.getIndirectHeapAllocation(NEO::HeapType::SURFACE_STATE);
+
+    auto result = commandList->appendBarrier(nullptr, 0, nullptr);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+    EXPECT_EQ(0u, csr->latestWaitForCompletionWithTimeoutTaskCount.load());
+
+    ASSERT_EQ(1u, commandList->commandContainer.getCmdBufferAllocations().size());
+    EXPECT_NE(submittedCmdBuffer, commandList->commandContainer.getCmdBufferAllocations()[0]);
+    EXPECT_NE(submittedSsh, commandList->commandContainer.getIndirectHeapAllocation(NEO::HeapType::SURFACE_STATE));
+
+    auto &reusableAllocations = csr->getInternalAllocationStorage()->getAllocationsForReuse();
+    EXPECT_TRUE(reusableAllocations.peekContains(*submittedCmdBuffer));
+    EXPECT_TRUE(reusableAllocations.peekContains(*submittedSsh));
+    EXPECT_EQ(csr->peekTaskCount(), submittedCmdBuffer->getTaskCount(csr->getOsContext().getContextId()));
+
+    *csr->getTagAddress() = csr->peekTaskCount();
+    result = commandList->appendBarrier(nullptr, 0, nullptr);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+    EXPECT_EQ(0u, csr->latestWaitForCompletionWithTimeoutTaskCount.load());
+    EXPECT_EQ(submittedCmdBuffer, commandList->commandContainer.getCmdBufferAllocations()[0]);
+
+    *csr->getTagAddress() = initialHardwareTag;
+}
+
+HWTEST_F(CommandListCreate, givenAsynchronousImmediateCommandListWithPrintfKernelWhenExecutingThenCsrIsWaitedAndPrintfOutputIsPrinted) {
+    ze_command_queue_desc_t desc = {};
+    desc.mode = ZE_COMMAND_QUEUE_MODE_ASYNCHRONOUS;
+    ze_result_t returnValue;
+    std::unique_ptr<L0::CommandList> commandList(CommandList::createImmediate(productFamily, device, &desc, false, NEO::EngineGroupType::RenderCompute, returnValue));
+    ASSERT_NE(nullptr, commandList);
+
+    auto csr = static_cast<NEO::UltCommandStreamReceiver<FamilyType> *>(static_cast<CommandQueueImp *>(commandList->cmdQImmediate)->getCsr());
+    csr->latestWaitForCompletionWithTimeoutTaskCount = 0u;
+
+    Mock<::L0::Kernel> kernel;
+    commandList->storePrintfFunction(&kernel);
+
+    auto result = commandList->executeCommandListImmediate(false);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+    EXPECT_EQ(csr->peekTaskCount(), csr->latestWaitForCompletionWithTimeoutTaskCount.load());
+    EXPECT_EQ(1u, kernel.printPrintfOutputCalledTimes);
+    EXPECT_TRUE(commandList->getPrintfFunctionContainer().empty());
+}
+
 TEST_F(CommandListCreate, givenInvalidProductFamilyThenReturnsNullPointer) {
     ze_result_t returnValue;
     std::unique_ptr<L0::CommandList> commandList(CommandList::create(IGFX_UNKNOWN, device, NEO::EngineGroupType::RenderCompute, returnValue));
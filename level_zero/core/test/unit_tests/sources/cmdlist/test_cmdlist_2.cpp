@@ -267,6 +267,27 @@ HWTEST2_F(CommandListCreate, givenImmediateCommandListWhenAppendWriteGlobalTimes
     commandList->cmdQImmediate = nullptr;
 }
 
+HWTEST2_F(CommandListCreate, givenImmediateCommandListWhenExecutingOnQueueFailsThenErrorIsReturnedAndListIsReset, Platforms) {
+    Mock<CommandQueue> cmdQueue;
+
+    auto commandList = std::make_unique<WhiteBox<L0::CommandListCoreFamilyImmediate<gfxCoreFamily>>>();
+    ASSERT_NE(nullptr, commandList);
+    ze_result_t ret = commandList->initialize(device, NEO::EngineGroupType::RenderCompute);
+    ASSERT_EQ(ZE_RESULT_SUCCESS, ret);
+    commandList->device = device;
+    commandList->cmdQImmediate = &cmdQueue;
+    commandList->cmdListType = CommandList::CommandListType::TYPE_IMMEDIATE;
+
+    EXPECT_CALL(cmdQueue, executeCommandLists).Times(1).WillRepeatedly(::testing::Return(ZE_RESULT_ERROR_DEVICE_LOST));
+    EXPECT_CALL(cmdQueue, synchronize).Times(0);
+
+    auto result = commandList->executeCommandListImmediate(true);
+    EXPECT_EQ(ZE_RESULT_ERROR_DEVICE_LOST, result);
+    EXPECT_EQ(0u, commandList->getClosedGeneration());
+
+    commandList->cmdQImmediate = nullptr;
+}
+
 using AppendMemoryCopy = CommandListCreate;
 
 template <GFXCORE_FAMILY gfxCoreFamily>
@@ -7,9 +7,12 @@
 
 #include "shared/source/command_container/command_encoder.h"
 #include "shared/test/unit_test/cmd_parse/gen_cmd_parse.h"
+#include "shared/test/unit_test/helpers/debug_manager_state_restore.h"
 
+#include "opencl/test/unit_test/mocks/mock_graphics_allocation.h"
 #include "test.h"
 
+#include "level_zero/core/source/cmdlist/barrier_elision.h"
 #include "level_zero/core/source/cmdlist/cmdlist_hw_immediate.h"
 #include "level_zero/core/test/unit_tests/fixtures/cmdlist_fixture.h"
 #include "level_zero/core/test/unit_tests/fixtures/device_fixture.h"
@@ -61,5 +64,155 @@ HWTEST_F(CommandListAppendBarrier, GivenEventWhenAppendingBarrierThenTwoPipeCont
     ASSERT_FALSE(itor.empty());
     ASSERT_LT(1, static_cast<int>(itor.size()));
 }
+
+TEST(BarrierElisionTrackerTest, givenNoPendingBarrierWhenKernelIsAddedThenBarrierIsNotRequired) {
+    NEO::MockGraphicsAllocation allocation;
+    BarrierElisionTracker tracker(BarrierElisionTracker::Mode::Enabled);
+    KernelMemoryAccesses accesses;
+    accesses.writes.push_back(&allocation);
+
+    EXPECT_FALSE(tracker.isBarrierRequiredBeforeKernel(accesses));
+    EXPECT_FALSE(tracker.isBarrierRequiredBeforeKernel(accesses));
+    EXPECT_FALSE(tracker.isBarrierPending());
+}
+
+TEST(BarrierElisionTrackerTest, givenPendingBarrierWhenKernelsAreIndependentThenBarrierIsElidedUntilDependentKernel) {
+    NEO::MockGraphicsAllocation allocationA, allocationB, allocationC;
+    BarrierElisionTracker tracker(BarrierElisionTracker::Mode::Enabled);
+
+    KernelMemoryAccesses writeA;
+    writeA.writes.push_back(&allocationA);
+    KernelMemoryAccesses writeB;
+    writeB.reads.push_back(&allocationC);
+    writeB.writes.push_back(&allocationB);
+    KernelMemoryAccesses readA;
+    readA.reads.push_back(&allocationA);
+
+    EXPECT_FALSE(tracker.isBarrierRequiredBeforeKernel(writeA));
+    tracker.deferBarrier();
+    EXPECT_FALSE(tracker.isBarrierRequiredBeforeKernel(writeB));
+    EXPECT_TRUE(tracker.isBarrierPending());
+    EXPECT_EQ(1u, tracker.getElidedBarriersCount());
+
+    EXPECT_TRUE(tracker.isBarrierRequiredBeforeKernel(readA));
+    EXPECT_FALSE(tracker.isBarrierPending());
+}
+
+TEST(BarrierElisionTrackerTest, givenConsecutiveBarriersWhenKernelDependsOnKernelBeforeFirstBarrierThenBarrierIsRequired) {
+    NEO::MockGraphicsAllocation allocationA, allocationB;
+    BarrierElisionTracker tracker(BarrierElisionTracker::Mode::Enabled);
+
+    KernelMemoryAccesses writeA;
+    writeA.writes.push_back(&allocationA);
+    KernelMemoryAccesses writeB;
+    writeB.writes.push_back(&allocationB);
+    KernelMemoryAccesses readB;
+    readB.reads.push_back(&allocationB);
+
+    tracker.isBarrierRequiredBeforeKernel(writeA);
+    tracker.deferBarrier();
+    EXPECT_FALSE(tracker.isBarrierRequiredBeforeKernel(writeB));
+    tracker.deferBarrier();
+    EXPECT_TRUE(tracker.isBarrierRequiredBeforeKernel(readB));
+}
+
+TEST(BarrierElisionTrackerTest, givenUnknownAccessesWhenBarrierIsPendingThenBarrierIsRequired) {
+    BarrierElisionTracker tracker(BarrierElisionTracker::Mode::Enabled);
+    KernelMemoryAccesses unknownAccesses;
+    unknownAccesses.unknown = true;
+
+    tracker.isBarrierRequiredBeforeKernel(KernelMemoryAccesses{});
+    tracker.deferBarrier();
+    EXPECT_TRUE(tracker.isBarrierRequiredBeforeKernel(unknownAccesses));
+}
+
+TEST(BarrierElisionTrackerTest, givenWriteOfCommandOtherThanKernelWhenKernelAfterBarrierReadsItThenBarrierIsRequired) {
+    NEO::MockGraphicsAllocation allocationA, allocationB;
+    BarrierElisionTracker tracker(BarrierElisionTracker::Mode::Enabled);
+
+    tracker.addAccesses(KernelMemoryAccesses::fromAllocation(&allocationA, true));
+    tracker.deferBarrier();
+    tracker.addAccesses(KernelMemoryAccesses::fromAllocation(&allocationB, true));
+    EXPECT_TRUE(tracker.isBarrierPending());
+    EXPECT_FALSE(tracker.isBarrierRequiredBeforeKernel(KernelMemoryAccesses::fromAllocation(&allocationB, false)));
+
+    tracker.deferBarrier();
+    EXPECT_TRUE(tracker.isBarrierRequiredBeforeKernel(KernelMemoryAccesses::fromAllocation(&allocationA, false)));
+    EXPECT_TRUE(KernelMemoryAccesses::fromAllocation(nullptr, true).unknown);
+}
+
+TEST(BarrierElisionTrackerTest, givenValidationModeWhenKernelsOnlyShareReadOnlyArgumentsThenMismatchWithBaselineIsReported) {
+    NEO::MockGraphicsAllocation allocation;
+    BarrierElisionTracker tracker(BarrierElisionTracker::Mode::Validation);
+    KernelMemoryAccesses readAccesses;
+    readAccesses.reads.push_back(&allocation);
+
+    tracker.isBarrierRequiredBeforeKernel(readAccesses);
+    tracker.deferBarrier();
+    EXPECT_FALSE(tracker.isBarrierRequiredBeforeKernel(readAccesses));
+    EXPECT_EQ(1u, tracker.getValidationMismatchesCount());
+
+    tracker.reset();
+    EXPECT_EQ(0u, tracker.getValidationMismatchesCount());
+    EXPECT_EQ(0u, tracker.getElidedBarriersCount());
+}
+
+TEST(BarrierElisionTrackerTest, givenDebugFlagWhenGettingModeThenFlagOverridesRelaxedOrdering) {
+    DebugManagerStateRestore restorer;
+    EXPECT_EQ(BarrierElisionTracker::Mode::Enabled, BarrierElisionTracker::getMode(true));
+    EXPECT_EQ(BarrierElisionTracker::Mode::Disabled, BarrierElisionTracker::getMode(false));
+
+    DebugManager.flags.EnableBarrierElision.set(0);
+    EXPECT_EQ(BarrierElisionTracker::Mode::Disabled, BarrierElisionTracker::getMode(true));
+    DebugManager.flags.EnableBarrierElision.set(2);
+    EXPECT_EQ(BarrierElisionTracker::Mode::Validation, BarrierElisionTracker::getMode(false));
+}
+
+HWTEST_F(CommandListAppendBarrier, givenBarrierElisionWhenAppendingBarrierWithoutEventsThenPipeControlIsDeferredUntilClose) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableBarrierElision.set(1);
+    commandList->initializeBarrierElision(false);
+    ASSERT_NE(nullptr, commandList->getBarrierElisionTracker());
+
+    auto usedSpaceBefore = commandList->commandContainer.getCommandStream()->getUsed();
+    auto result = commandList->appendBarrier(nullptr, 0, nullptr);
+    ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+    EXPECT_EQ(usedSpaceBefore, commandList->commandContainer.getCommandStream()->getUsed());
+    EXPECT_TRUE(commandList->getBarrierElisionTracker()->isBarrierPending());
+
+    commandList->close();
+    EXPECT_FALSE(commandList->getBarrierElisionTracker()->isBarrierPending());
+    EXPECT_LT(usedSpaceBefore, commandList->commandContainer.getCommandStream()->getUsed());
+}
+
+HWTEST_F(CommandListAppendBarrier, givenBarrierElisionWhenAppendingBarrierWithSignalEventThenPipeControlIsProgrammed) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableBarrierElision.set(1);
+    commandList->initializeBarrierElision(false);
+
+    auto usedSpaceBefore = commandList->commandContainer.getCommandStream()->getUsed();
+    auto result = commandList->appendBarrier(event->toHandle(), 0, nullptr);
+    ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+    EXPECT_LT(usedSpaceBefore, commandList->commandContainer.getCommandStream()->getUsed());
+    EXPECT_FALSE(commandList->getBarrierElisionTracker()->isBarrierPending());
+}
+
+HWTEST_F(CommandListAppendBarrier, givenBarrierElisionWhenEventIsSignaledBeforeBarrierThenKernelReadingEventAllocationRequiresBarrier) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableBarrierElision.set(1);
+    commandList->initializeBarrierElision(false);
+    auto tracker = commandList->getBarrierElisionTracker();
+    ASSERT_NE(nullptr, tracker);
+
+    auto result = commandList->appendSignalEvent(event->toHandle());
+    ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+    result = commandList->appendBarrier(nullptr, 0, nullptr);
+    ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+    EXPECT_TRUE(tracker->isBarrierPending());
+
+    EXPECT_TRUE(tracker->isBarrierRequiredBeforeKernel(KernelMemoryAccesses::fromAllocation(&event->getAllocation(), false)));
+    EXPECT_FALSE(tracker->isBarrierPending());
+}
+
 } // namespace ult
-} // namespace L0
\ No newline at end of file
+} // namespace L0
@@ -9,10 +9,13 @@
 #include "shared/source/helpers/preamble.h"
 #include "shared/source/helpers/register_offsets.h"
 #include "shared/test/unit_test/cmd_parse/gen_cmd_parse.h"
+#include "shared/test/unit_test/helpers/debug_manager_state_restore.h"
 
+#include "opencl/test/unit_test/mocks/mock_graphics_allocation.h"
 #include "test.h"
 
 #include "level_zero/core/source/cmdlist/cmdlist_hw_immediate.h"
+#include "level_zero/core/source/get_extension_function_lookup_map.h"
 #include "level_zero/core/test/unit_tests/fixtures/module_fixture.h"
 #include "level_zero/core/test/unit_tests/mocks/mock_cmdlist.h"
 #include "level_zero/core/test/unit_tests/mocks/mock_cmdqueue.h"
@@ -155,6 +158,8 @@ HWTEST_F(CommandListAppendLaunchKernel, givenKernelWithPrintfUsedWhenAppendedToC
 }
 
 HWTEST_F(CommandListAppendLaunchKernel, WhenAppendingMultipleTimesThenSshIsNotDepletedButReallocated) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableDispatchStateReuse.set(false);
     createKernel();
     ze_result_t returnValue;
     std::unique_ptr<L0::CommandList> commandList(CommandList::create(productFamily, device, NEO::EngineGroupType::RenderCompute, returnValue));
@@ -176,6 +181,34 @@ HWTEST_F(CommandListAppendLaunchKernel, WhenAppendingMultipleTimesThenSshIsNotDe
     EXPECT_NE(initialAllocation, reallocatedAllocation);
 }
 
+HWTEST_F(CommandListAppendLaunchKernel, givenDispatchStateReuseWhenAppendingSameKernelTwiceThenSurfaceStatesAreSharedUntilArgumentsChange) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableDispatchStateReuse.set(true);
+    createKernel();
+    ze_result_t returnValue;
+    std::unique_ptr<L0::CommandList> commandList(CommandList::create(productFamily, device, NEO::EngineGroupType::RenderCompute, returnValue));
+    ze_group_count_t groupCount{1, 1, 1};
+
+    auto ssh = commandList->commandContainer.getIndirectHeap(NEO::HeapType::SURFACE_STATE);
+    auto result = commandList->appendLaunchKernel(kernel->toHandle(), &groupCount, nullptr, 0, nullptr);
+    ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+    auto sshUsed = ssh->getUsed();
+    auto nextIdd = commandList->commandContainer.nextIddInBlock;
+
+    result = commandList->appendLaunchKernel(kernel->toHandle(), &groupCount, nullptr, 0, nullptr);
+    ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+    EXPECT_EQ(sshUsed, ssh->getUsed());
+    EXPECT_EQ(nextIdd, commandList->commandContainer.nextIddInBlock);
+
+    commandList->commandContainer.lastDispatchState.invalidate();
+    result = commandList->appendLaunchKernel(kernel->toHandle(), &groupCount, nullptr, 0, nullptr);
+    ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+    if (kernel->getImmutableData()->getDescriptor().payloadMappings.bindingTable.numEntries > 0) {
+        EXPECT_LT(sshUsed, ssh->getUsed());
+    }
+    EXPECT_LT(nextIdd, commandList->commandContainer.nextIddInBlock);
+}
+
 using SklPlusMatcher = IsAtLeastProduct<IGFX_SKYLAKE>;
 HWTEST2_F(CommandListAppendLaunchKernel, WhenAppendingFunctionThenUsedCmdBufferSizeDoesNotExceedEstimate, SklPlusMatcher) {
     createKernel();
@@ -521,6 +554,112 @@ HWTEST_F(CommandListAppendLaunchKernel, givenCommandListWhenResetCalledThenState
     EXPECT_NE(cmdList.end(), itor);
 }
 
+HWTEST_F(CommandListAppendLaunchKernel, givenClosedCommandListWhenUpdatingKernelLaunchArgumentsThenCrossThreadDataIsPatchedInPlace) {
+    createKernel();
+
+    ze_result_t returnValue;
+    std::unique_ptr<L0::CommandList> commandList(L0::CommandList::create(productFamily, device, NEO::EngineGroupType::RenderCompute, returnValue));
+
+    ze_group_count_t groupCount{1, 1, 1};
+    EXPECT_EQ(ZE_RESULT_SUCCESS, commandList->appendLaunchKernel(kernel->toHandle(), &groupCount, nullptr, 0, nullptr));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, commandList->appendLaunchKernel(kernel->toHandle(), &groupCount, nullptr, 0, nullptr));
+    EXPECT_EQ(2u, commandList->getKernelLaunchesCount());
+
+    auto ioh = commandList->commandContainer.getIndirectHeap(NEO::HeapType::INDIRECT_OBJECT);
+    auto crossThreadDataSize = kernel->getCrossThreadDataSize();
+    auto encodedCrossThreadData = ptrOffset(ioh->getCpuBase(), ioh->getUsed() - kernel->getPerThreadDataSizeForWholeThreadGroup() - crossThreadDataSize);
+    commandList->close();
+    auto cmdBufferUsed = commandList->commandContainer.getCommandStream()->getUsed();
+    auto closedGeneration = commandList->getClosedGeneration();
+
+    memset(kernel->crossThreadData.get(), 0xAB, crossThreadDataSize);
+    EXPECT_NE(0, memcmp(encodedCrossThreadData, kernel->getCrossThreadData(), crossThreadDataSize));
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, commandList->updateKernelLaunchArguments(1u, kernel->toHandle()));
+    EXPECT_EQ(0, memcmp(encodedCrossThreadData, kernel->getCrossThreadData(), crossThreadDataSize));
+    EXPECT_EQ(cmdBufferUsed, commandList->commandContainer.getCommandStream()->getUsed());
+    EXPECT_NE(closedGeneration, commandList->getClosedGeneration());
+
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, commandList->updateKernelLaunchArguments(2u, kernel->toHandle()));
+
+    commandList->reset();
+    EXPECT_EQ(0u, commandList->getKernelLaunchesCount());
+}
+
+HWTEST_F(CommandListAppendLaunchKernel, givenUpdatedKernelArgumentsWhenUpdatingThroughExtensionFunctionThenResidencyOfReplacedArgumentsIsRemoved) {
+    createKernel();
+    NEO::MockGraphicsAllocation oldArgument, newArgument, sharedArgument;
+
+    ze_result_t returnValue;
+    std::unique_ptr<L0::CommandList> commandList(L0::CommandList::create(productFamily, device, NEO::EngineGroupType::RenderCompute, returnValue));
+    auto &residencyContainer = commandList->commandContainer.getResidencyContainer();
+
+    //shared argument is used also by a command other than kernel launch, so it has to stay resident
+    commandList->commandContainer.addToResidencyContainer(&sharedArgument);
+    kernel->residencyContainer.push_back(&oldArgument);
+    kernel->residencyContainer.push_back(&sharedArgument);
+    ze_group_count_t groupCount{1, 1, 1};
+    EXPECT_EQ(ZE_RESULT_SUCCESS, commandList->appendLaunchKernel(kernel->toHandle(), &groupCount, nullptr, 0, nullptr));
+    commandList->close();
+    kernel->residencyContainer.pop_back();
+    kernel->residencyContainer.pop_back();
+
+    void *extensionFunction = nullptr;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, driverHandle->getExtensionFunctionAddress("zexCommandListUpdateKernelLaunchArguments", &extensionFunction));
+    ASSERT_NE(nullptr, extensionFunction);
+    auto updateKernelLaunchArguments = reinterpret_cast<decltype(&zexCommandListUpdateKernelLaunchArguments)>(extensionFunction);
+
+    kernel->residencyContainer.push_back(&newArgument);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, updateKernelLaunchArguments(commandList->toHandle(), 0u, kernel->toHandle()));
+    kernel->residencyContainer.pop_back();
+
+    EXPECT_EQ(residencyContainer.end(), std::find(residencyContainer.begin(), residencyContainer.end(), &oldArgument));
+    EXPECT_EQ(1, std::count(residencyContainer.begin(), residencyContainer.end(), &newArgument));
+    EXPECT_EQ(1, std::count(residencyContainer.begin(), residencyContainer.end(), &sharedArgument));
+    EXPECT_EQ(1, std::count(residencyContainer.begin(), residencyContainer.end(), kernel->getIsaAllocation()));
+}
+
+HWTEST_F(CommandListAppendLaunchKernel, givenSlmSizeOrThreadsPerGroupDifferentThanRecordedWhenUpdatingKernelLaunchArgumentsThenUpdateIsRejected) {
+    createKernel();
+
+    ze_result_t returnValue;
+    std::unique_ptr<L0::CommandList> commandList(L0::CommandList::create(productFamily, device, NEO::EngineGroupType::RenderCompute, returnValue));
+    ze_group_count_t groupCount{1, 1, 1};
+    EXPECT_EQ(ZE_RESULT_SUCCESS, commandList->appendLaunchKernel(kernel->toHandle(), &groupCount, nullptr, 0, nullptr));
+    commandList->close();
+    auto closedGeneration = commandList->getClosedGeneration();
+
+    kernel->slmArgsTotalSize += 1024u;
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, commandList->updateKernelLaunchArguments(0u, kernel->toHandle()));
+    kernel->slmArgsTotalSize -= 1024u;
+
+    kernel->numThreadsPerThreadGroup++;
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, commandList->updateKernelLaunchArguments(0u, kernel->toHandle()));
+    kernel->numThreadsPerThreadGroup--;
+
+    EXPECT_EQ(closedGeneration, commandList->getClosedGeneration());
+    EXPECT_EQ(ZE_RESULT_SUCCESS, commandList->updateKernelLaunchArguments(0u, kernel->toHandle()));
+}
+
+HWTEST_F(CommandListAppendLaunchKernel, givenCommandListSubmissionInFlightWhenUpdatingKernelLaunchArgumentsThenUpdateIsRejected) {
+    createKernel();
+
+    ze_result_t returnValue;
+    std::unique_ptr<L0::CommandList> commandList(L0::CommandList::create(productFamily, device, NEO::EngineGroupType::RenderCompute, returnValue));
+    ze_group_count_t groupCount{1, 1, 1};
+    EXPECT_EQ(ZE_RESULT_SUCCESS, commandList->appendLaunchKernel(kernel->toHandle(), &groupCount, nullptr, 0, nullptr));
+    commandList->close();
+
+    auto &engine = neoDevice->getDefaultEngine();
+    auto ioh = commandList->commandContainer.getIndirectHeap(NEO::HeapType::INDIRECT_OBJECT)->getGraphicsAllocation();
+    auto completedTaskCount = *engine.commandStreamReceiver->getTagAddress();
+    ioh->updateTaskCount(completedTaskCount + 1, engine.osContext->getContextId());
+    EXPECT_EQ(ZE_RESULT_ERROR_NOT_AVAILABLE, commandList->updateKernelLaunchArguments(0u, kernel->toHandle()));
+
+    ioh->updateTaskCount(completedTaskCount, engine.osContext->getContextId());
+    EXPECT_EQ(ZE_RESULT_SUCCESS, commandList->updateKernelLaunchArguments(0u, kernel->toHandle()));
+}
+
 HWTEST_F(CommandListAppendLaunchKernel, WhenAddingKernelsThenResidencyContainerDoesNotContainDuplicatesAfterClosingCommandList) {
     Mock<::L0::Kernel> kernel;
 
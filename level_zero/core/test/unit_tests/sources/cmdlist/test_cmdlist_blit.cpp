@@ -7,11 +7,13 @@
 
 #include "shared/source/helpers/register_offsets.h"
 #include "shared/test/unit_test/cmd_parse/gen_cmd_parse.h"
+#include "shared/test/unit_test/helpers/debug_manager_state_restore.h"
 
 #include "opencl/test/unit_test/mocks/mock_graphics_allocation.h"
 #include "test.h"
 
 #include "level_zero/core/source/builtin/builtin_functions_lib_impl.h"
+#include "level_zero/core/source/cmdlist/split_memory_copy.h"
 #include "level_zero/core/source/image/image_hw.h"
 #include "level_zero/core/source/kernel/kernel_imp.h"
 #include "level_zero/core/test/unit_tests/fixtures/device_fixture.h"
@@ -440,5 +442,43 @@ HWTEST2_F(AppendMemoryfillHostPtr, givenCommandListAndHostPointerWhenMemoryfillC
     deviceMock.get()->setDriverHandle(driverHandle.get());
 }
 
+TEST(SplitMemoryCopyBandwidthModelTest, givenEqualEnginesWhenComputingCopyEngineShareThenHalfOfCopyIsAssignedToCopyEngine) {
+    SplitMemoryCopyBandwidthModel model;
+    model.copyEngineBandwidth = model.computeBandwidth = 1000.0;
+    model.copyEngineLatency = model.computeLatency = 10.0;
+
+    EXPECT_EQ(512u * MemoryConstants::megaByte, model.getCopyEngineShare(MemoryConstants::gigaByte));
+}
+
+TEST(SplitMemoryCopyBandwidthModelTest, givenSlowerEngineWithLowerLatencyWhenComputingCopyEngineShareThenShareIsClampedToCopySize) {
+    SplitMemoryCopyBandwidthModel model;
+    model.copyEngineBandwidth = 1000.0;
+    model.copyEngineLatency = 0.0;
+    model.computeBandwidth = 3000.0;
+    model.computeLatency = 100.0;
+
+    EXPECT_EQ(4096u, model.getCopyEngineShare(4096u));
+    EXPECT_EQ(25u * MemoryConstants::megaByte + 75000u, model.getCopyEngineShare(100u * MemoryConstants::megaByte));
+
+    model.copyEngineLatency = 200.0;
+    model.computeLatency = 0.0;
+    EXPECT_EQ(0u, model.getCopyEngineShare(4096u));
+}
+
+TEST(SplitMemoryCopyBandwidthModelTest, givenBandwidthDebugFlagsWhenCreatingModelThenFlagsOverrideDefaults) {
+    DebugManagerStateRestore restorer;
+    NEO::DebugManager.flags.SplitMemoryCopyCopyEngineBandwidth.set(100);
+    NEO::DebugManager.flags.SplitMemoryCopyComputeBandwidth.set(300);
+
+    auto model = SplitMemoryCopyBandwidthModel::create();
+    EXPECT_EQ(100.0, model.copyEngineBandwidth);
+    EXPECT_EQ(300.0, model.computeBandwidth);
+}
+
+TEST(SplitMemoryCopyTest, givenDefaultDebugFlagsThenSplitMemoryCopyIsDisabled) {
+    EXPECT_FALSE(SplitMemoryCopy::isEnabled());
+    EXPECT_EQ(SplitMemoryCopy::defaultMinSize, SplitMemoryCopy::getMinSize());
+}
+
 } // namespace ult
 } // namespace L0
@@ -5,8 +5,11 @@
  *
  */
 
+#include "shared/source/direct_submission/submission_timeline.h"
+#include "shared/source/helpers/hw_helper.h"
 #include "shared/source/helpers/state_base_address.h"
 #include "shared/source/os_interface/device_factory.h"
+#include "shared/test/unit_test/cmd_parse/gen_cmd_parse.h"
 #include "shared/test/unit_test/helpers/debug_manager_state_restore.h"
 #include "shared/test/unit_test/helpers/default_hw_info.h"
 #include "shared/test/unit_test/mocks/mock_command_stream_receiver.h"
@@ -23,6 +26,8 @@
 #include "level_zero/core/test/unit_tests/mocks/mock_kernel.h"
 #include "level_zero/core/test/unit_tests/mocks/mock_memory_manager.h"
 
+#include <sstream>
+
 namespace L0 {
 namespace ult {
 
@@ -242,6 +247,234 @@ HWTEST_F(CommandQueueCommands, givenCommandQueueWhenExecutingCommandListsThenHar
     commandQueue->destroy();
 }
 
+HWTEST_F(CommandQueueCommands, givenCommandListsSharingAllocationWhenExecutingCommandListsThenAllocationIsPassedForResidencyOnce) {
+    const ze_command_queue_desc_t desc = {};
+
+    MockCsrHw2<FamilyType> csr(*neoDevice->getExecutionEnvironment(), 0);
+    csr.initializeTagAllocation();
+    csr.setupContext(*neoDevice->getDefaultEngine().osContext);
+
+    L0::CommandQueue *commandQueue = CommandQueue::create(productFamily,
+                                                          device,
+                                                          &csr,
+                                                          &desc,
+                                                          true);
+    ASSERT_NE(nullptr, commandQueue);
+
+    ze_result_t returnValue;
+    std::unique_ptr<L0::CommandList> commandList0(CommandList::create(productFamily, device, NEO::EngineGroupType::Copy, returnValue));
+    std::unique_ptr<L0::CommandList> commandList1(CommandList::create(productFamily, device, NEO::EngineGroupType::Copy, returnValue));
+
+    auto sharedAllocation = csr.getTagAllocation();
+    commandList0->commandContainer.addToResidencyContainer(sharedAllocation);
+    commandList1->commandContainer.addToResidencyContainer(sharedAllocation);
+
+    ze_command_list_handle_t commandListHandles[] = {commandList0->toHandle(), commandList1->toHandle()};
+    auto status = commandQueue->executeCommandLists(2, commandListHandles, nullptr, false);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, status);
+
+    EXPECT_EQ(1, std::count(csr.copyOfAllocations.begin(), csr.copyOfAllocations.end(), sharedAllocation));
+    commandQueue->destroy();
+}
+
+HWTEST_F(CommandQueueCommands, givenInvalidCommandListTypeWhenExecutingCommandListsThenCsrOwnershipIsNotTaken) {
+    const ze_command_queue_desc_t desc = {};
+
+    MockCsrHw2<FamilyType> csr(*neoDevice->getExecutionEnvironment(), 0);
+    csr.initializeTagAllocation();
+    csr.setupContext(*neoDevice->getDefaultEngine().osContext);
+
+    L0::CommandQueue *commandQueue = CommandQueue::create(productFamily,
+                                                          device,
+                                                          &csr,
+                                                          &desc,
+                                                          true);
+    ASSERT_NE(nullptr, commandQueue);
+
+    ze_result_t returnValue;
+    std::unique_ptr<L0::CommandList> commandList(CommandList::create(productFamily, device, NEO::EngineGroupType::RenderCompute, returnValue));
+    auto commandListHandle = commandList->toHandle();
+    auto lockCounter = csr.recursiveLockCounter.load();
+    auto status = commandQueue->executeCommandLists(1, &commandListHandle, nullptr, false);
+
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_COMMAND_LIST_TYPE, status);
+    EXPECT_EQ(lockCounter, csr.recursiveLockCounter.load());
+    commandQueue->destroy();
+}
+
+HWTEST_F(CommandQueueCommands, givenSameClosedCommandListExecutedAgainWhenExecutingCommandListsThenRecordedSubmissionIsReplayedWithSameResidency) {
+    DebugManagerStateRestore restorer;
+    NEO::DebugManager.flags.EnableCommandQueueSubmissionReplay.set(true);
+
+    const ze_command_queue_desc_t desc = {};
+
+    MockCsrHw2<FamilyType> csr(*neoDevice->getExecutionEnvironment(), 0);
+    csr.initializeTagAllocation();
+    csr.setupContext(*neoDevice->getDefaultEngine().osContext);
+
+    auto commandQueue = static_cast<L0::CommandQueueImp *>(CommandQueue::create(productFamily,
+                                                                                device,
+                                                                                &csr,
+                                                                                &desc,
+                                                                                true));
+    ASSERT_NE(nullptr, commandQueue);
+
+    ze_result_t returnValue;
+    std::unique_ptr<L0::CommandList> commandList(CommandList::create(productFamily, device, NEO::EngineGroupType::Copy, returnValue));
+    commandList->close();
+    auto commandListHandle = commandList->toHandle();
+
+    auto status = commandQueue->executeCommandLists(1, &commandListHandle, nullptr, false);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, status);
+    EXPECT_EQ(0u, commandQueue->getReplayedSubmissionsCount());
+    auto firstResidency = csr.copyOfAllocations;
+
+    status = commandQueue->executeCommandLists(1, &commandListHandle, nullptr, false);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, status);
+    EXPECT_EQ(1u, commandQueue->getReplayedSubmissionsCount());
+    EXPECT_EQ(firstResidency, csr.copyOfAllocations);
+
+    status = commandQueue->executeCommandLists(1, &commandListHandle, nullptr, false);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, status);
+    EXPECT_EQ(2u, commandQueue->getReplayedSubmissionsCount());
+    EXPECT_EQ(commandQueue->getTaskCount(), csr.peekTaskCount());
+
+    commandQueue->destroy();
+}
+
+HWTEST_F(CommandQueueCommands, givenCommandListResetAndClosedAgainWhenExecutingCommandListsThenSubmissionIsNotReplayed) {
+    DebugManagerStateRestore restorer;
+    NEO::DebugManager.flags.EnableCommandQueueSubmissionReplay.set(true);
+
+    const ze_command_queue_desc_t desc = {};
+
+    MockCsrHw2<FamilyType> csr(*neoDevice->getExecutionEnvironment(), 0);
+    csr.initializeTagAllocation();
+    csr.setupContext(*neoDevice->getDefaultEngine().osContext);
+
+    auto commandQueue = static_cast<L0::CommandQueueImp *>(CommandQueue::create(productFamily,
+                                                                                device,
+                                                                                &csr,
+                                                                                &desc,
+                                                                                true));
+    ASSERT_NE(nullptr, commandQueue);
+
+    ze_result_t returnValue;
+    std::unique_ptr<L0::CommandList> commandList(CommandList::create(productFamily, device, NEO::EngineGroupType::Copy, returnValue));
+    commandList->close();
+    auto commandListHandle = commandList->toHandle();
+    commandQueue->executeCommandLists(1, &commandListHandle, nullptr, false);
+
+    auto closedGeneration = commandList->getClosedGeneration();
+    commandList->reset();
+    EXPECT_EQ(0u, commandList->getClosedGeneration());
+    commandList->close();
+    EXPECT_NE(closedGeneration, commandList->getClosedGeneration());
+
+    commandQueue->executeCommandLists(1, &commandListHandle, nullptr, false);
+    EXPECT_EQ(0u, commandQueue->getReplayedSubmissionsCount());
+
+    commandQueue->executeCommandLists(1, &commandListHandle, nullptr, false);
+    EXPECT_EQ(1u, commandQueue->getReplayedSubmissionsCount());
+
+    commandQueue->destroy();
+}
+
+HWTEST_F(CommandQueueCommands, givenSubmissionReplayDisabledWhenExecutingSameCommandListAgainThenSubmissionIsNotReplayed) {
+    DebugManagerStateRestore restorer;
+    NEO::DebugManager.flags.EnableCommandQueueSubmissionReplay.set(false);
+
+    const ze_command_queue_desc_t desc = {};
+
+    MockCsrHw2<FamilyType> csr(*neoDevice->getExecutionEnvironment(), 0);
+    csr.initializeTagAllocation();
+    csr.setupContext(*neoDevice->getDefaultEngine().osContext);
+
+    auto commandQueue = static_cast<L0::CommandQueueImp *>(CommandQueue::create(productFamily,
+                                                                                device,
+                                                                                &csr,
+                                                                                &desc,
+                                                                                true));
+    ASSERT_NE(nullptr, commandQueue);
+
+    ze_result_t returnValue;
+    std::unique_ptr<L0::CommandList> commandList(CommandList::create(productFamily, device, NEO::EngineGroupType::Copy, returnValue));
+    commandList->close();
+    auto commandListHandle = commandList->toHandle();
+    commandQueue->executeCommandLists(1, &commandListHandle, nullptr, false);
+    commandQueue->executeCommandLists(1, &commandListHandle, nullptr, false);
+
+    EXPECT_EQ(0u, commandQueue->getReplayedSubmissionsCount());
+    commandQueue->destroy();
+}
+
+using CommandQueueStateShadowTest = Test<DeviceFixture>;
+
+HWTEST_F(CommandQueueStateShadowTest, givenCommandListExecutedRepeatedlyWhenStateDidNotChangeThenStateCommandsAreEmittedOnlyOnce) {
+    DebugManagerStateRestore restorer;
+    NEO::DebugManager.flags.EnableCommandQueueSubmissionReplay.set(false);
+
+    ze_command_queue_desc_t desc = {};
+    auto commandQueue = whitebox_cast(CommandQueue::create(productFamily, device, neoDevice->getDefaultEngine().commandStreamReceiver, &desc, false));
+    ASSERT_NE(nullptr, commandQueue);
+
+    ze_result_t returnValue;
+    std::unique_ptr<L0::CommandList> commandList(CommandList::create(productFamily, device, NEO::EngineGroupType::RenderCompute, returnValue));
+    auto commandListHandle = commandList->toHandle();
+
+    auto result = commandQueue->executeCommandLists(1, &commandListHandle, nullptr, false);
+    ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+    auto stateCommandsAfterFirstExecute = commandQueue->getEmittedStateCommandsCount();
+    EXPECT_NE(0u, stateCommandsAfterFirstExecute);
+
+    auto usedSpaceBefore = commandQueue->commandStream->getUsed();
+    for (uint32_t i = 0; i < 4; i++) {
+        result = commandQueue->executeCommandLists(1, &commandListHandle, nullptr, false);
+        ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+    }
+    EXPECT_EQ(stateCommandsAfterFirstExecute, commandQueue->getEmittedStateCommandsCount());
+
+    GenCmdList cmdList;
+    ASSERT_TRUE(FamilyType::PARSE::parseCommandBuffer(
+        cmdList, ptrOffset(commandQueue->commandStream->getCpuBase(), usedSpaceBefore), commandQueue->commandStream->getUsed() - usedSpaceBefore));
+    using STATE_BASE_ADDRESS = typename FamilyType::STATE_BASE_ADDRESS;
+    using MEDIA_VFE_STATE = typename FamilyType::MEDIA_VFE_STATE;
+    EXPECT_EQ(0u, findAll<STATE_BASE_ADDRESS *>(cmdList.begin(), cmdList.end()).size());
+    EXPECT_EQ(0u, findAll<MEDIA_VFE_STATE *>(cmdList.begin(), cmdList.end()).size());
+
+    commandQueue->destroy();
+}
+
+HWTEST_F(CommandQueueStateShadowTest, givenThreadArbitrationPolicyChangedWhenExecutingCommandListThenOnlyThreadArbitrationIsReprogrammed) {
+    DebugManagerStateRestore restorer;
+    NEO::DebugManager.flags.EnableCommandQueueSubmissionReplay.set(false);
+
+    ze_command_queue_desc_t desc = {};
+    auto commandQueue = whitebox_cast(CommandQueue::create(productFamily, device, neoDevice->getDefaultEngine().commandStreamReceiver, &desc, false));
+    ASSERT_NE(nullptr, commandQueue);
+
+    ze_result_t returnValue;
+    std::unique_ptr<L0::CommandList> commandList(CommandList::create(productFamily, device, NEO::EngineGroupType::RenderCompute, returnValue));
+    auto commandListHandle = commandList->toHandle();
+
+    commandQueue->executeCommandLists(1, &commandListHandle, nullptr, false);
+    auto stateCommandsAfterFirstExecute = commandQueue->getEmittedStateCommandsCount();
+
+    auto &hwHelper = NEO::HwHelper::get(neoDevice->getHardwareInfo().platform.eRenderCoreFamily);
+    auto otherPolicy = hwHelper.getDefaultThreadArbitrationPolicy() == NEO::ThreadArbitrationPolicy::RoundRobin
+                           ? NEO::ThreadArbitrationPolicy::AgeBased
+                           : NEO::ThreadArbitrationPolicy::RoundRobin;
+    NEO::DebugManager.flags.OverrideThreadArbitrationPolicy.set(static_cast<int32_t>(otherPolicy));
+
+    commandQueue->executeCommandLists(1, &commandListHandle, nullptr, false);
+    EXPECT_EQ(stateCommandsAfterFirstExecute + 1, commandQueue->getEmittedStateCommandsCount());
+
+    commandQueue->executeCommandLists(1, &commandListHandle, nullptr, false);
+    EXPECT_EQ(stateCommandsAfterFirstExecute + 1, commandQueue->getEmittedStateCommandsCount());
+
+    commandQueue->destroy();
+}
+
 using CommandQueueIndirectAllocations = Test<ModuleFixture>;
 HWTEST_F(CommandQueueIndirectAllocations, givenCommandQueueWhenExecutingCommandListsThenExpectedIndirectAllocationsAddedToResidencyContainer) {
     const ze_command_queue_desc_t desc = {};
@@ -297,6 +530,223 @@ HWTEST_F(CommandQueueIndirectAllocations, givenCommandQueueWhenExecutingCommandL
     commandQueue->destroy();
 }
 
+HWTEST_F(CommandQueueIndirectAllocations, givenCommandListWithIndirectAllocationsWhenExecutedRepeatedlyThenItsResidencyContainerDoesNotGrow) {
+    const ze_command_queue_desc_t desc = {};
+
+    MockCsrHw2<FamilyType> csr(*neoDevice->getExecutionEnvironment(), 0);
+    csr.initializeTagAllocation();
+    csr.setupContext(*neoDevice->getDefaultEngine().osContext);
+
+    L0::CommandQueue *commandQueue = CommandQueue::create(productFamily,
+                                                          device,
+                                                          &csr,
+                                                          &desc,
+                                                          true);
+    ASSERT_NE(nullptr, commandQueue);
+
+    ze_result_t returnValue;
+    std::unique_ptr<L0::CommandList> commandList(CommandList::create(productFamily, device, NEO::EngineGroupType::Copy, returnValue));
+
+    void *deviceAlloc = nullptr;
+    auto result = device->getDriverHandle()->allocDeviceMem(device->toHandle(), 0u, 16384u, 4096u, &deviceAlloc);
+    ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+
+    createKernel();
+    kernel->unifiedMemoryControls.indirectDeviceAllocationsAllowed = true;
+
+    ze_group_count_t groupCount{1, 1, 1};
+    result = commandList->appendLaunchKernel(kernel->toHandle(),
+                                             &groupCount,
+                                             nullptr,
+                                             0,
+                                             nullptr);
+    ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+    commandList->close();
+
+    auto commandListHandle = commandList->toHandle();
+    result = commandQueue->executeCommandLists(1, &commandListHandle, nullptr, false);
+    ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+    auto residencySize = commandList->commandContainer.getResidencyContainer().size();
+
+    result = commandQueue->executeCommandLists(1, &commandListHandle, nullptr, false);
+    ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+    EXPECT_EQ(residencySize, commandList->commandContainer.getResidencyContainer().size());
+
+    device->getDriverHandle()->getSvmAllocsManager()->freeSVMAlloc(deviceAlloc);
+    commandQueue->destroy();
+}
+
+HWTEST_F(CommandQueueIndirectAllocations, givenIndirectAllocationCreatedAfterFirstExecutionWhenCommandListIsExecutedAgainThenAllocationIsAddedToResidencyContainer) {
+    const ze_command_queue_desc_t desc = {};
+
+    MockCsrHw2<FamilyType> csr(*neoDevice->getExecutionEnvironment(), 0);
+    csr.initializeTagAllocation();
+    csr.setupContext(*neoDevice->getDefaultEngine().osContext);
+
+    L0::CommandQueue *commandQueue = CommandQueue::create(productFamily,
+                                                          device,
+                                                          &csr,
+                                                          &desc,
+                                                          true);
+    ASSERT_NE(nullptr, commandQueue);
+
+    ze_result_t returnValue;
+    std::unique_ptr<L0::CommandList> commandList(CommandList::create(productFamily, device, NEO::EngineGroupType::Copy, returnValue));
+
+    void *deviceAlloc = nullptr;
+    auto result = device->getDriverHandle()->allocDeviceMem(device->toHandle(), 0u, 16384u, 4096u, &deviceAlloc);
+    ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+
+    createKernel();
+    kernel->unifiedMemoryControls.indirectDeviceAllocationsAllowed = true;
+
+    ze_group_count_t groupCount{1, 1, 1};
+    result = commandList->appendLaunchKernel(kernel->toHandle(),
+                                             &groupCount,
+                                             nullptr,
+                                             0,
+                                             nullptr);
+    ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+    commandList->close();
+
+    auto commandListHandle = commandList->toHandle();
+    result = commandQueue->executeCommandLists(1, &commandListHandle, nullptr, false);
+    ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+    auto residencySize = commandList->commandContainer.getResidencyContainer().size();
+
+    void *secondDeviceAlloc = nullptr;
+    result = device->getDriverHandle()->allocDeviceMem(device->toHandle(), 0u, 16384u, 4096u, &secondDeviceAlloc);
+    ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+    auto secondGpuAlloc = device->getDriverHandle()->getSvmAllocsManager()->getSVMAllocs()->get(secondDeviceAlloc)->gpuAllocations.getGraphicsAllocation(device->getRootDeviceIndex());
+
+    result = commandQueue->executeCommandLists(1, &commandListHandle, nullptr, false);
+    ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+    auto &residencyContainer = commandList->commandContainer.getResidencyContainer();
+    EXPECT_EQ(residencySize + 1, residencyContainer.size());
+    EXPECT_EQ(1, std::count(residencyContainer.begin(), residencyContainer.end(), secondGpuAlloc));
+
+    device->getDriverHandle()->getSvmAllocsManager()->freeSVMAlloc(secondDeviceAlloc);
+    device->getDriverHandle()->getSvmAllocsManager()->freeSVMAlloc(deviceAlloc);
+    commandQueue->destroy();
+}
+
+HWTEST_F(CommandQueueIndirectAllocations, givenIndirectAllocationFreedAfterExecutionWhenKernelLaunchArgumentsAreUpdatedThenFreedAllocationIsNotResidentOnNextExecution) {
+    const ze_command_queue_desc_t desc = {};
+
+    MockCsrHw2<FamilyType> csr(*neoDevice->getExecutionEnvironment(), 0);
+    csr.initializeTagAllocation();
+    csr.setupContext(*neoDevice->getDefaultEngine().osContext);
+
+    L0::CommandQueue *commandQueue = CommandQueue::create(productFamily,
+                                                          device,
+                                                          &csr,
+                                                          &desc,
+                                                          false);
+    ASSERT_NE(nullptr, commandQueue);
+
+    ze_result_t returnValue;
+    std::unique_ptr<L0::CommandList> commandList(CommandList::create(productFamily, device, NEO::EngineGroupType::RenderCompute, returnValue));
+
+    void *deviceAlloc = nullptr;
+    auto result = device->getDriverHandle()->allocDeviceMem(device->toHandle(), 0u, 16384u, 4096u, &deviceAlloc);
+    ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+    auto gpuAlloc = device->getDriverHandle()->getSvmAllocsManager()->getSVMAllocs()->get(deviceAlloc)->gpuAllocations.getGraphicsAllocation(device->getRootDeviceIndex());
+
+    createKernel();
+    kernel->unifiedMemoryControls.indirectDeviceAllocationsAllowed = true;
+
+    ze_group_count_t groupCount{1, 1, 1};
+    result = commandList->appendLaunchKernel(kernel->toHandle(),
+                                             &groupCount,
+                                             nullptr,
+                                             0,
+                                             nullptr);
+    ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+    commandList->close();
+
+    auto commandListHandle = commandList->toHandle();
+    result = commandQueue->executeCommandLists(1, &commandListHandle, nullptr, false);
+    ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+    auto &residencyContainer = commandList->commandContainer.getResidencyContainer();
+    EXPECT_EQ(1, std::count(residencyContainer.begin(), residencyContainer.end(), gpuAlloc));
+
+    device->getDriverHandle()->getSvmAllocsManager()->freeSVMAlloc(deviceAlloc);
+
+    //submission is treated as completed, so the payload may be patched
+    auto &engine = neoDevice->getDefaultEngine();
+    auto ioh = commandList->commandContainer.getIndirectHeap(NEO::HeapType::INDIRECT_OBJECT)->getGraphicsAllocation();
+    ioh->updateTaskCount(*engine.commandStreamReceiver->getTagAddress(), engine.osContext->getContextId());
+    result = commandList->updateKernelLaunchArguments(0u, kernel->toHandle());
+    ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+    EXPECT_EQ(0, std::count(residencyContainer.begin(), residencyContainer.end(), gpuAlloc));
+
+    result = commandQueue->executeCommandLists(1, &commandListHandle, nullptr, false);
+    ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+    EXPECT_EQ(0, std::count(residencyContainer.begin(), residencyContainer.end(), gpuAlloc));
+    EXPECT_EQ(0, std::count(csr.copyOfAllocations.begin(), csr.copyOfAllocations.end(), gpuAlloc));
+
+    commandQueue->destroy();
+}
+
+using CommandQueueGatherResidencySupport = IsAtLeastProduct<IGFX_SKYLAKE>;
+
+HWTEST2_F(CommandQueueIndirectAllocations, givenCommandListWithIndirectAccessWhenGatheringCommandListsStateThenCommandListResidencyIsNotModified, CommandQueueGatherResidencySupport) {
+    const ze_command_queue_desc_t desc = {};
+
+    MockCsrHw2<FamilyType> csr(*neoDevice->getExecutionEnvironment(), 0);
+    csr.initializeTagAllocation();
+    csr.setupContext(*neoDevice->getDefaultEngine().osContext);
+
+    L0::CommandQueue *commandQueue = CommandQueue::create(productFamily,
+                                                          device,
+                                                          &csr,
+                                                          &desc,
+                                                          true);
+    ASSERT_NE(nullptr, commandQueue);
+    auto commandQueueHw = static_cast<L0::CommandQueueHw<gfxCoreFamily> *>(commandQueue);
+
+    ze_result_t returnValue;
+    std::unique_ptr<L0::CommandList> commandList(CommandList::create(productFamily, device, NEO::EngineGroupType::Copy, returnValue));
+
+    void *deviceAlloc = nullptr;
+    auto result = device->getDriverHandle()->allocDeviceMem(device->toHandle(), 0u, 16384u, 4096u, &deviceAlloc);
+    ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+    auto gpuAlloc = device->getDriverHandle()->getSvmAllocsManager()->getSVMAllocs()->get(deviceAlloc)->gpuAllocations.getGraphicsAllocation(device->getRootDeviceIndex());
+
+    createKernel();
+    kernel->unifiedMemoryControls.indirectDeviceAllocationsAllowed = true;
+
+    ze_group_count_t groupCount{1, 1, 1};
+    result = commandList->appendLaunchKernel(kernel->toHandle(),
+                                             &groupCount,
+                                             nullptr,
+                                             0,
+                                             nullptr);
+    ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+    commandList->close();
+
+    auto &listResidency = commandList->commandContainer.getResidencyContainer();
+    auto residencySize = listResidency.size();
+
+    auto commandListHandle = commandList->toHandle();
+    NEO::ResidencyContainer commandListsResidency;
+    NEO::HeapContainer heapContainer;
+    size_t totalCmdBuffers = 0u;
+    commandQueueHw->gatherCommandListsState(1, &commandListHandle, nullptr, commandListsResidency, heapContainer, totalCmdBuffers);
+    EXPECT_EQ(residencySize, listResidency.size());
+    EXPECT_EQ(0, std::count(commandListsResidency.begin(), commandListsResidency.end(), gpuAlloc));
+
+    {
+        auto lockCSR = csr.obtainUniqueOwnership();
+        commandQueueHw->gatherIndirectAllocationsResidency(1, &commandListHandle, nullptr, commandListsResidency);
+    }
+    EXPECT_EQ(1, std::count(listResidency.begin(), listResidency.end(), gpuAlloc));
+    EXPECT_EQ(1, std::count(commandListsResidency.begin(), commandListsResidency.end(), gpuAlloc));
+
+    device->getDriverHandle()->getSvmAllocsManager()->freeSVMAlloc(deviceAlloc);
+    commandQueue->destroy();
+}
+
 using ContextCreateCommandQueueTest = Test<ContextFixture>;
 
 TEST_F(ContextCreateCommandQueueTest, givenCallToContextCreateCommandQueueThenCallSucceeds) {
@@ -402,6 +852,98 @@ HWTEST2_F(CommandQueueDestroy, givenCommandQueueAndCommandListWithSshAndScratchW
     alignedFree(alloc);
 }
 
+template <typename GfxFamily>
+struct CommandBufferManagerCsr : public NEO::UltCommandStreamReceiver<GfxFamily> {
+    CommandBufferManagerCsr(NEO::ExecutionEnvironment &executionEnvironment) : NEO::UltCommandStreamReceiver<GfxFamily>(executionEnvironment, 0) {}
+
+    bool waitForCompletionWithTimeout(bool enableTimeout, int64_t timeoutMs, uint32_t taskCountToWait) override {
+        waitForCompletionCalledTimes++;
+        lastWaitedTaskCount = taskCountToWait;
+        completedTaskCount = taskCountToWait;
+        return true;
+    }
+
+    volatile uint32_t *getTagAddress() const override {
+        return &completedTaskCount;
+    }
+
+    uint32_t waitForCompletionCalledTimes = 0;
+    uint32_t lastWaitedTaskCount = 0;
+    mutable uint32_t completedTaskCount = 0;
+};
+
+using CommandBufferManagerTest = Test<DeviceFixture>;
+
+HWTEST_F(CommandBufferManagerTest, givenBuffersNotCompletedWhenSwitchingBuffersThenNewBufferIsAllocatedWithoutWaiting) {
+    CommandBufferManagerCsr<FamilyType> csr(*neoDevice->getExecutionEnvironment());
+    L0::CommandQueueImp::CommandBufferManager buffers;
+    buffers.initialize(device, L0::CommandQueueImp::totalCmdBufferSize);
+    EXPECT_EQ(L0::CommandQueueImp::CommandBufferManager::initialBuffersCount, buffers.getBuffersCount());
+
+    std::vector<NEO::GraphicsAllocation *> usedAllocations;
+    for (uint32_t taskCount = 1; taskCount <= 4; taskCount++) {
+        usedAllocations.push_back(buffers.getCurrentBufferAllocation());
+        buffers.setCurrentFlushStamp(0u, taskCount);
+        buffers.switchBuffers(&csr);
+    }
+
+    EXPECT_EQ(5u, buffers.getBuffersCount());
+    EXPECT_EQ(0u, buffers.getStallCount());
+    EXPECT_EQ(0u, csr.waitForCompletionCalledTimes);
+    for (auto allocation : usedAllocations) {
+        EXPECT_NE(allocation, buffers.getCurrentBufferAllocation());
+    }
+
+    buffers.destroy(neoDevice->getMemoryManager());
+}
+
+HWTEST_F(CommandBufferManagerTest, givenOldestBufferCompletedWhenSwitchingBuffersThenItIsReusedWithoutWaiting) {
+    CommandBufferManagerCsr<FamilyType> csr(*neoDevice->getExecutionEnvironment());
+    L0::CommandQueueImp::CommandBufferManager buffers;
+    buffers.initialize(device, L0::CommandQueueImp::totalCmdBufferSize);
+
+    auto firstAllocation = buffers.getCurrentBufferAllocation();
+    buffers.setCurrentFlushStamp(0u, 1u);
+    buffers.switchBuffers(&csr);
+    auto secondAllocation = buffers.getCurrentBufferAllocation();
+    buffers.setCurrentFlushStamp(0u, 2u);
+
+    csr.completedTaskCount = 1u;
+    buffers.switchBuffers(&csr);
+
+    EXPECT_EQ(firstAllocation, buffers.getCurrentBufferAllocation());
+    EXPECT_NE(secondAllocation, buffers.getCurrentBufferAllocation());
+    EXPECT_EQ(L0::CommandQueueImp::CommandBufferManager::initialBuffersCount, buffers.getBuffersCount());
+    EXPECT_EQ(0u, buffers.getStallCount());
+    EXPECT_EQ(0u, csr.waitForCompletionCalledTimes);
+
+    buffers.destroy(neoDevice->getMemoryManager());
+}
+
+HWTEST_F(CommandBufferManagerTest, givenMaxBuffersAllocatedAndNoneCompletedWhenSwitchingBuffersThenStallIsCountedAndOldestBufferIsWaitedFor) {
+    DebugManagerStateRestore restorer;
+    NEO::DebugManager.flags.L0CommandQueueMaxCommandBuffers.set(3);
+
+    CommandBufferManagerCsr<FamilyType> csr(*neoDevice->getExecutionEnvironment());
+    L0::CommandQueueImp::CommandBufferManager buffers;
+    buffers.initialize(device, L0::CommandQueueImp::totalCmdBufferSize);
+    EXPECT_EQ(3u, buffers.getMaxBuffersCount());
+
+    auto oldestAllocation = buffers.getCurrentBufferAllocation();
+    for (uint32_t taskCount = 1; taskCount <= 3; taskCount++) {
+        buffers.setCurrentFlushStamp(0u, taskCount);
+        buffers.switchBuffers(&csr);
+    }
+
+    EXPECT_EQ(3u, buffers.getBuffersCount());
+    EXPECT_EQ(1u, buffers.getStallCount());
+    EXPECT_EQ(1u, csr.waitForCompletionCalledTimes);
+    EXPECT_EQ(1u, csr.lastWaitedTaskCount);
+    EXPECT_EQ(oldestAllocation, buffers.getCurrentBufferAllocation());
+
+    buffers.destroy(neoDevice->getMemoryManager());
+}
+
 using CommandQueueSynchronizeTest = Test<ContextFixture>;
 
 HWTEST_F(CommandQueueSynchronizeTest, givenCallToSynchronizeThenCorrectEnableTimeoutAndTimeoutValuesAreUsed) {
@@ -452,5 +994,48 @@ HWTEST_F(CommandQueueSynchronizeTest, givenCallToSynchronizeThenCorrectEnableTim
     L0::CommandQueue::fromHandle(commandQueue)->destroy();
 }
 
+
+HWTEST_F(CommandQueueCreate, givenSubmissionTimelineEnabledWhenExecutingCommandListsThenExecutionIsRecordedAndCompletionTimestampIsWritten) {
+    using PIPE_CONTROL = typename FamilyType::PIPE_CONTROL;
+    DebugManagerStateRestore restorer;
+    NEO::DebugManager.flags.EnableSubmissionTimeline.set(true);
+    NEO::SubmissionTimeline::getInstance().reset();
+
+    ze_command_queue_desc_t desc = {};
+    auto csr = neoDevice->getDefaultEngine().commandStreamReceiver;
+    auto commandQueue = whitebox_cast(CommandQueue::create(productFamily, device, csr, &desc, false));
+    ASSERT_NE(nullptr, commandQueue);
+
+    ze_result_t returnValue;
+    std::unique_ptr<L0::CommandList> commandList(CommandList::create(productFamily, device, NEO::EngineGroupType::RenderCompute, returnValue));
+    auto commandListHandle = commandList->toHandle();
+
+    auto usedSpaceBefore = commandQueue->commandStream->getUsed();
+    auto timestampAddress = csr->getCompletionTimestampGPUAddress(csr->peekTaskCount() + 1);
+    auto result = commandQueue->executeCommandLists(1, &commandListHandle, nullptr, false);
+    ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+
+    GenCmdList cmdList;
+    ASSERT_TRUE(FamilyType::PARSE::parseCommandBuffer(
+        cmdList, ptrOffset(commandQueue->commandStream->getCpuBase(), usedSpaceBefore), commandQueue->commandStream->getUsed() - usedSpaceBefore));
+    bool timestampFound = false;
+    for (auto it : findAll<PIPE_CONTROL *>(cmdList.begin(), cmdList.end())) {
+        auto cmd = genCmdCast<PIPE_CONTROL *>(*it);
+        if (cmd->getPostSyncOperation() == PIPE_CONTROL::POST_SYNC_OPERATION_WRITE_TIMESTAMP &&
+            cmd->getAddressHigh() == timestampAddress >> 32u &&
+            cmd->getAddress() == static_cast<uint32_t>(timestampAddress)) {
+            timestampFound = true;
+        }
+    }
+    EXPECT_TRUE(timestampFound);
+
+    std::stringstream trace;
+    NEO::SubmissionTimeline::getInstance().exportChromeTrace(trace);
+    NEO::SubmissionTimeline::getInstance().reset();
+    EXPECT_NE(std::string::npos, trace.str().find("\"name\":\"enqueue\""));
+
+    commandQueue->destroy();
+}
+
 } // namespace ult
 } // namespace L0
@@ -12,6 +12,7 @@
 #include "test.h"
 
 #include "level_zero/core/source/cmdqueue/cmdqueue_imp.h"
+#include "level_zero/core/source/device/host_ptr_allocation_cache.h"
 #include "level_zero/core/test/unit_tests/mocks/mock_driver_handle.h"
 
 #include "gtest/gtest.h"
@@ -90,6 +91,56 @@ TEST_F(DeviceTest, givenEmptySVmAllocStorageWhenAllocateMemoryFromHostPtrThenVal
     neoDevice->getMemoryManager()->freeGraphicsMemory(allocation);
 }
 
+TEST_F(DeviceTest, givenHostPtrAllocationCacheWhenSameHostPointerIsAcquiredTwiceThenAllocationCoveringRangeIsShared) {
+    DebugManager.flags.EnableHostPtrTracking.set(0);
+    constexpr auto dataSize = 1024u;
+    auto data = std::make_unique<int[]>(dataSize);
+
+    auto cache = std::make_unique<HostPtrAllocationCache>(*device);
+
+    auto allocationFirst = cache->acquire(data.get(), sizeof(int) * dataSize);
+    auto allocationSecond = cache->acquire(data.get() + 16, sizeof(int) * 16);
+    ASSERT_NE(nullptr, allocationFirst);
+    EXPECT_EQ(allocationFirst, allocationSecond);
+    EXPECT_EQ(1u, cache->getEntriesCount());
+
+    EXPECT_TRUE(cache->release(allocationFirst));
+    EXPECT_TRUE(cache->release(allocationSecond));
+    EXPECT_EQ(0u, cache->getEntriesCount());
+}
+
+TEST_F(DeviceTest, givenHostPtrAllocationCacheWhenLastReferenceIsReleasedThenAllocationIsDestroyedAndNotReusedForSameAddress) {
+    DebugManager.flags.EnableHostPtrTracking.set(0);
+    constexpr auto dataSize = 1024u;
+    auto data = std::make_unique<int[]>(dataSize);
+
+    HostPtrAllocationCache cache(*device);
+    auto allocationFirst = cache.acquire(data.get(), sizeof(int) * dataSize);
+    auto allocationSecond = cache.acquire(data.get(), sizeof(int) * dataSize);
+    ASSERT_NE(nullptr, allocationFirst);
+    EXPECT_EQ(allocationFirst, allocationSecond);
+    EXPECT_EQ(1u, cache.getEntriesCount());
+
+    EXPECT_TRUE(cache.release(allocationFirst));
+    EXPECT_EQ(1u, cache.getEntriesCount());
+    EXPECT_TRUE(cache.release(allocationSecond));
+    EXPECT_EQ(0u, cache.getEntriesCount());
+
+    auto allocationThird = cache.acquire(data.get(), sizeof(int) * dataSize);
+    ASSERT_NE(nullptr, allocationThird);
+    EXPECT_EQ(1u, cache.getEntriesCount());
+    EXPECT_TRUE(cache.release(allocationThird));
+}
+
+TEST_F(DeviceTest, givenHostPtrAllocationCacheWhenReleasingAllocationNotOwnedByCacheThenFalseIsReturned) {
+    int data;
+    auto allocation = device->allocateMemoryFromHostPtr(&data, sizeof(data));
+    ASSERT_NE(nullptr, allocation);
+
+    EXPECT_FALSE(device->getHostPtrAllocationCache()->release(allocation));
+    neoDevice->getMemoryManager()->freeGraphicsMemory(allocation);
+}
+
 struct MemoryManagerHostPointer : public NEO::OsAgnosticMemoryManager {
     MemoryManagerHostPointer(NEO::ExecutionEnvironment &executionEnvironment) : OsAgnosticMemoryManager(const_cast<NEO::ExecutionEnvironment &>(executionEnvironment)) {}
     GraphicsAllocation *allocateGraphicsMemoryWithProperties(const AllocationProperties &properties,
@@ -5,13 +5,21 @@
  *
  */
 
+#include "shared/test/unit_test/mocks/mock_command_stream_receiver.h"
+
 #include "opencl/test/unit_test/mocks/mock_memory_operations_handler.h"
 #include "test.h"
 
 #include "level_zero/core/source/driver/driver_handle_imp.h"
+#include "level_zero/core/source/get_extension_function_lookup_map.h"
 #include "level_zero/core/test/unit_tests/fixtures/device_fixture.h"
 #include "level_zero/core/test/unit_tests/mocks/mock_event.h"
 
+#include <atomic>
+
+extern std::atomic<uintptr_t> lastClFlushedPtr;
+extern std::atomic<uint32_t> sfenceCounter;
+
 namespace L0 {
 namespace ult {
 using EventPoolCreate = Test<DeviceFixture>;
@@ -47,6 +55,82 @@ TEST_F(EventPoolCreate, givenTimestampEventsThenEventSizeSufficientForAllKernelT
     EXPECT_EQ(kernelTimestampsSize, eventPool->getEventSize());
 }
 
+TEST_F(EventPoolCreate, givenEventPoolThenEachEventOccupiesSeparateCachelines) {
+    ze_event_pool_desc_t eventPoolDesc = {};
+    eventPoolDesc.count = 2;
+    eventPoolDesc.flags = ZE_EVENT_POOL_FLAG_HOST_VISIBLE;
+
+    std::unique_ptr<L0::EventPool> eventPool(EventPool::create(driverHandle.get(), 0, nullptr, &eventPoolDesc));
+    ASSERT_NE(nullptr, eventPool);
+
+    EXPECT_TRUE(isAligned<MemoryConstants::cacheLineSize>(eventPool->getAllocation().getUnderlyingBuffer()));
+    EXPECT_EQ(0u, eventPool->getEventSize() % MemoryConstants::cacheLineSize);
+}
+
+TEST_F(EventPoolCreate, givenRangeOfEventsWhenHostSignalEventsAndResetEventsExtensionsCalledThenOnlyEventsInRangeChangeState) {
+    ze_event_pool_desc_t eventPoolDesc = {};
+    eventPoolDesc.count = 4;
+    eventPoolDesc.flags = ZE_EVENT_POOL_FLAG_HOST_VISIBLE;
+
+    std::unique_ptr<L0::EventPool> eventPool(EventPool::create(driverHandle.get(), 0, nullptr, &eventPoolDesc));
+    ASSERT_NE(nullptr, eventPool);
+
+    ze_event_desc_t eventDesc = {};
+    eventDesc.signal = ZE_EVENT_SCOPE_FLAG_HOST;
+    eventDesc.wait = ZE_EVENT_SCOPE_FLAG_HOST;
+    std::unique_ptr<L0::Event> events[4];
+    for (uint32_t i = 0; i < 4; i++) {
+        eventDesc.index = i;
+        events[i].reset(L0::Event::create(eventPool.get(), &eventDesc, device));
+        ASSERT_NE(nullptr, events[i]);
+    }
+
+    void *extensionFunction = nullptr;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, driverHandle->getExtensionFunctionAddress("zexEventPoolHostSignalEvents", &extensionFunction));
+    ASSERT_NE(nullptr, extensionFunction);
+    auto hostSignalEvents = reinterpret_cast<decltype(&zexEventPoolHostSignalEvents)>(extensionFunction);
+    extensionFunction = nullptr;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, driverHandle->getExtensionFunctionAddress("zexEventPoolHostResetEvents", &extensionFunction));
+    ASSERT_NE(nullptr, extensionFunction);
+    auto hostResetEvents = reinterpret_cast<decltype(&zexEventPoolHostResetEvents)>(extensionFunction);
+
+    uint32_t sfenceCountBefore = sfenceCounter.load();
+    EXPECT_EQ(ZE_RESULT_SUCCESS, hostSignalEvents(eventPool->toHandle(), 1u, 2u));
+    EXPECT_EQ(sfenceCountBefore + 1, sfenceCounter);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(events[2]->hostAddress), lastClFlushedPtr);
+
+    EXPECT_EQ(ZE_RESULT_NOT_READY, events[0]->queryStatus());
+    EXPECT_EQ(ZE_RESULT_SUCCESS, events[1]->queryStatus());
+    EXPECT_EQ(ZE_RESULT_SUCCESS, events[2]->queryStatus());
+    EXPECT_EQ(ZE_RESULT_NOT_READY, events[3]->queryStatus());
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, hostResetEvents(eventPool->toHandle(), 0u, 4u));
+    for (auto &event : events) {
+        EXPECT_EQ(ZE_RESULT_NOT_READY, event->queryStatus());
+    }
+}
+
+TEST_F(EventPoolCreate, givenRangeOutsideOfEventPoolWhenHostSignalEventsOrResetEventsExtensionsCalledThenErrorIsReturned) {
+    ze_event_pool_desc_t eventPoolDesc = {};
+    eventPoolDesc.count = 4;
+    eventPoolDesc.flags = ZE_EVENT_POOL_FLAG_HOST_VISIBLE;
+
+    std::unique_ptr<L0::EventPool> eventPool(EventPool::create(driverHandle.get(), 0, nullptr, &eventPoolDesc));
+    ASSERT_NE(nullptr, eventPool);
+
+    void *hostSignalEvents = nullptr;
+    void *hostResetEvents = nullptr;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, driverHandle->getExtensionFunctionAddress("zexEventPoolHostSignalEvents", &hostSignalEvents));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, driverHandle->getExtensionFunctionAddress("zexEventPoolHostResetEvents", &hostResetEvents));
+    ASSERT_NE(nullptr, hostSignalEvents);
+    ASSERT_NE(nullptr, hostResetEvents);
+
+    auto eventPoolHandle = eventPool->toHandle();
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, reinterpret_cast<decltype(&zexEventPoolHostSignalEvents)>(hostSignalEvents)(eventPoolHandle, 0u, 0u));
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, reinterpret_cast<decltype(&zexEventPoolHostSignalEvents)>(hostSignalEvents)(eventPoolHandle, 4u, 1u));
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, reinterpret_cast<decltype(&zexEventPoolHostResetEvents)>(hostResetEvents)(eventPoolHandle, 3u, 2u));
+}
+
 TEST_F(EventPoolCreate, givenAnEventIsCreatedFromThisEventPoolThenEventContainsDeviceCommandStreamReceiver) {
     ze_event_pool_desc_t eventPoolDesc = {};
     eventPoolDesc.count = 1;
@@ -91,6 +175,57 @@ TEST_F(EventCreate, givenAnEventCreatedThenTheEventHasTheDeviceCommandStreamRece
     ASSERT_EQ(static_cast<DeviceImp *>(device)->neoDevice->getDefaultEngine().commandStreamReceiver, event.get()->csr);
 }
 
+TEST_F(EventCreate, givenNotSignaledEventWhenQueryingStatusThenOnlyEventPoolAllocationIsDownloaded) {
+    ze_event_pool_desc_t eventPoolDesc = {};
+    eventPoolDesc.count = 1;
+    eventPoolDesc.flags = ZE_EVENT_POOL_FLAG_HOST_VISIBLE;
+
+    ze_event_desc_t eventDesc = {};
+    eventDesc.signal = ZE_EVENT_SCOPE_FLAG_HOST;
+    eventDesc.wait = ZE_EVENT_SCOPE_FLAG_HOST;
+
+    std::unique_ptr<L0::EventPool> eventPool(EventPool::create(driverHandle.get(), 0, nullptr, &eventPoolDesc));
+    ASSERT_NE(nullptr, eventPool);
+    std::unique_ptr<L0::Event> event(L0::Event::create(eventPool.get(), &eventDesc, device));
+    ASSERT_NE(nullptr, event);
+
+    auto csr = std::make_unique<NEO::MockCommandStreamReceiver>(*neoDevice->getExecutionEnvironment(), 0);
+    event->csr = csr.get();
+
+    EXPECT_EQ(ZE_RESULT_NOT_READY, event->queryStatus());
+    EXPECT_TRUE(csr->downloadAllocationIfPendingCalled);
+    EXPECT_FALSE(csr->downloadAllocationsCalled);
+
+    event->hostSignal();
+    EXPECT_EQ(ZE_RESULT_SUCCESS, event->queryStatus());
+    EXPECT_TRUE(csr->downloadAllocationsCalled);
+}
+
+TEST_F(EventCreate, givenSingleSubmissionWhenQueryingNotSignaledEventThenCoalescedSubmissionsAreFlushed) {
+    ze_event_pool_desc_t eventPoolDesc = {};
+    eventPoolDesc.count = 1;
+    eventPoolDesc.flags = ZE_EVENT_POOL_FLAG_HOST_VISIBLE;
+
+    ze_event_desc_t eventDesc = {};
+    eventDesc.signal = ZE_EVENT_SCOPE_FLAG_HOST;
+    eventDesc.wait = ZE_EVENT_SCOPE_FLAG_HOST;
+
+    std::unique_ptr<L0::EventPool> eventPool(EventPool::create(driverHandle.get(), 0, nullptr, &eventPoolDesc));
+    ASSERT_NE(nullptr, eventPool);
+    std::unique_ptr<L0::Event> event(L0::Event::create(eventPool.get(), &eventDesc, device));
+    ASSERT_NE(nullptr, event);
+
+    auto csr = std::make_unique<NEO::MockCommandStreamReceiver>(*neoDevice->getExecutionEnvironment(), 0);
+    event->csr = csr.get();
+
+    EXPECT_EQ(ZE_RESULT_NOT_READY, event->queryStatus());
+    EXPECT_EQ(1u, csr->flushCoalescedSubmissionsCalled);
+
+    event->hostSignal();
+    EXPECT_EQ(ZE_RESULT_SUCCESS, event->queryStatus());
+    EXPECT_EQ(1u, csr->flushCoalescedSubmissionsCalled);
+}
+
 TEST_F(EventCreate, givenAnEventCreateWithInvalidIndexUsingThisEventPoolThenErrorIsReturned) {
     ze_event_pool_desc_t eventPoolDesc = {
         ZE_STRUCTURE_TYPE_EVENT_POOL_DESC,
@@ -203,6 +338,24 @@ TEST_F(TimestampEventCreate, givenSingleTimestampEventThenAllocationSizeCreatedF
     EXPECT_GE(minTimestampEventAllocation, allocation->getUnderlyingBufferSize());
 }
 
+TEST_F(TimestampEventCreate, givenTimestampEventWhenSignaledAndResetFromHostThenAllTimestampsAreWrittenAndFlushedOnce) {
+    lastClFlushedPtr = 0u;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, event->hostSignal());
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(event->hostAddress), lastClFlushedPtr);
+
+    auto timestamps = static_cast<KernelTimestampEvent *>(event->hostAddress);
+    EXPECT_EQ(static_cast<uint32_t>(Event::STATE_SIGNALED), timestamps->contextStart);
+    EXPECT_EQ(static_cast<uint32_t>(Event::STATE_SIGNALED), timestamps->globalStart);
+    EXPECT_EQ(static_cast<uint32_t>(Event::STATE_SIGNALED), timestamps->contextEnd);
+    EXPECT_EQ(static_cast<uint32_t>(Event::STATE_SIGNALED), timestamps->globalEnd);
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, eventPool->resetEvents(0u, 1u));
+    EXPECT_EQ(static_cast<uint32_t>(Event::STATE_INITIAL), timestamps->contextStart);
+    EXPECT_EQ(static_cast<uint32_t>(Event::STATE_INITIAL), timestamps->globalStart);
+    EXPECT_EQ(static_cast<uint32_t>(Event::STATE_INITIAL), timestamps->contextEnd);
+    EXPECT_EQ(static_cast<uint32_t>(Event::STATE_INITIAL), timestamps->globalEnd);
+}
+
 TEST_F(TimestampEventCreate, givenTimestampEventThenAllocationsIsOfPacketTagBufferType) {
     auto allocation = &eventPool->getAllocation();
     ASSERT_NE(nullptr, allocation);
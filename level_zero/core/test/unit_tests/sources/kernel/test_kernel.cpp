@@ -70,6 +70,72 @@ HWTEST_F(KernelImpSetGroupSizeTest, givenLocalIdGenerationByRuntimeDisabledWhenS
     EXPECT_EQ(nullptr, mockKernel.perThreadDataForWholeThreadGroup);
 }
 
+HWTEST_F(KernelImpSetGroupSizeTest, givenUnchangedGroupSizeWhenSettingGroupSizeThenLocalIdsAreNotRegenerated) {
+    Mock<Kernel> mockKernel;
+    Mock<Module> mockModule(this->device, nullptr);
+    mockKernel.descriptor.kernelAttributes.simdSize = 1;
+    mockKernel.module = &mockModule;
+
+    auto ret = mockKernel.setGroupSize(2, 3, 5);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, ret);
+    auto perThreadData = mockKernel.perThreadDataForWholeThreadGroup;
+    ASSERT_NE(nullptr, perThreadData);
+    perThreadData[0] = 0xff;
+
+    ret = mockKernel.setGroupSize(2, 3, 5);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, ret);
+    EXPECT_EQ(perThreadData, mockKernel.perThreadDataForWholeThreadGroup);
+    EXPECT_EQ(0xff, mockKernel.perThreadDataForWholeThreadGroup[0]);
+    EXPECT_EQ(1u, mockKernel.localIdsCache.size());
+}
+
+HWTEST_F(KernelImpSetGroupSizeTest, givenPreviouslyUsedGroupSizeWhenSettingGroupSizeThenCachedLocalIdsAreReused) {
+    Mock<Kernel> mockKernel;
+    Mock<Module> mockModule(this->device, nullptr);
+    mockKernel.descriptor.kernelAttributes.simdSize = 1;
+    mockKernel.module = &mockModule;
+
+    mockKernel.setGroupSize(2, 3, 5);
+    auto perThreadData = mockKernel.perThreadDataForWholeThreadGroup;
+    auto perThreadDataSize = mockKernel.perThreadDataSizeForWholeThreadGroup;
+    perThreadData[0] = 0xff;
+
+    mockKernel.setGroupSize(4, 1, 1);
+    EXPECT_NE(perThreadData, mockKernel.perThreadDataForWholeThreadGroup);
+    EXPECT_EQ(2u, mockKernel.localIdsCache.size());
+
+    mockKernel.setGroupSize(2, 3, 5);
+    EXPECT_EQ(perThreadData, mockKernel.perThreadDataForWholeThreadGroup);
+    EXPECT_EQ(perThreadDataSize, mockKernel.perThreadDataSizeForWholeThreadGroup);
+    EXPECT_EQ(0xff, mockKernel.perThreadDataForWholeThreadGroup[0]);
+}
+
+HWTEST_F(KernelImpSetGroupSizeTest, givenMoreGroupSizesThanCacheEntriesWhenSettingGroupSizeThenLeastRecentlyUsedEntryIsReplaced) {
+    Mock<Kernel> mockKernel;
+    Mock<Module> mockModule(this->device, nullptr);
+    mockKernel.descriptor.kernelAttributes.simdSize = 1;
+    mockKernel.module = &mockModule;
+
+    const uint32_t cacheSize = static_cast<uint32_t>(mockKernel.localIdsCacheSize);
+    for (uint32_t groupSizeX = 1; groupSizeX <= cacheSize + 1; groupSizeX++) {
+        mockKernel.setGroupSize(groupSizeX, 1, 1);
+    }
+    EXPECT_EQ(cacheSize, mockKernel.localIdsCache.size());
+
+    bool firstGroupSizeCached = false;
+    for (auto &entry : mockKernel.localIdsCache) {
+        firstGroupSizeCached |= (entry.groupSize[0] == 1u);
+    }
+    EXPECT_FALSE(firstGroupSizeCached);
+
+    using LocalIdT = unsigned short;
+    auto generatedLocalIds = reinterpret_cast<LocalIdT *>(mockKernel.perThreadDataForWholeThreadGroup);
+    auto threadOffsetInLocalIds = mockModule.getDevice()->getHwInfo().capabilityTable.grfSize / sizeof(LocalIdT);
+    for (uint32_t threadId = 0; threadId < cacheSize + 1; threadId++) {
+        EXPECT_EQ(threadId, generatedLocalIds[threadId * threadOffsetInLocalIds]);
+    }
+}
+
 using SetKernelArg = Test<ModuleFixture>;
 using ImageSupport = IsWithinProducts<IGFX_SKYLAKE, IGFX_TIGERLAKE_LP>;
 
@@ -5,6 +5,7 @@
  *
  */
 
+#include "shared/source/helpers/string.h"
 #include "shared/test/unit_test/helpers/debug_manager_state_restore.h"
 
 #include "opencl/test/unit_test/mocks/mock_memory_manager.h"
@@ -41,6 +42,57 @@ TEST_F(MemoryTest, givenDevicePointerThenDriverGetAllocPropertiesReturnsDeviceHa
     ASSERT_EQ(result, ZE_RESULT_SUCCESS);
 }
 
+TEST_F(MemoryTest, givenIpcHandleOpenedTwiceWhenClosingThenImportIsReleasedWithLastClose) {
+    uint64_t handle = 0x1000u;
+    ze_ipc_mem_handle_t ipcHandle = {};
+    memcpy_s(ipcHandle.data, sizeof(ipcHandle.data), &handle, sizeof(handle));
+    ze_ipc_memory_flag_t flags = {};
+
+    void *ptr = nullptr;
+    ze_result_t result = driverHandle->openIpcMemHandle(device->toHandle(), ipcHandle, flags, &ptr);
+    ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+    EXPECT_NE(nullptr, ptr);
+
+    void *secondPtr = nullptr;
+    result = driverHandle->openIpcMemHandle(device->toHandle(), ipcHandle, flags, &secondPtr);
+    ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+    EXPECT_EQ(ptr, secondPtr);
+    EXPECT_EQ(1u, driverHandle->getIpcImportsCount());
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, driverHandle->closeIpcMemHandle(ptr));
+    EXPECT_EQ(1u, driverHandle->getIpcImportsCount());
+    EXPECT_NE(nullptr, driverHandle->getSvmAllocsManager()->getSVMAlloc(ptr));
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, driverHandle->closeIpcMemHandle(ptr));
+    EXPECT_EQ(0u, driverHandle->getIpcImportsCount());
+    EXPECT_EQ(nullptr, driverHandle->getSvmAllocsManager()->getSVMAlloc(ptr));
+
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, driverHandle->closeIpcMemHandle(ptr));
+}
+
+TEST_F(MemoryTest, givenIpcHandleOpenedTwiceWhenMemoryIsFreedThenImportIsDroppedWithLastReference) {
+    uint64_t handle = 0x1000u;
+    ze_ipc_mem_handle_t ipcHandle = {};
+    memcpy_s(ipcHandle.data, sizeof(ipcHandle.data), &handle, sizeof(handle));
+    ze_ipc_memory_flag_t flags = {};
+
+    void *ptr = nullptr;
+    ze_result_t result = driverHandle->openIpcMemHandle(device->toHandle(), ipcHandle, flags, &ptr);
+    ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+    void *secondPtr = nullptr;
+    result = driverHandle->openIpcMemHandle(device->toHandle(), ipcHandle, flags, &secondPtr);
+    ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+    EXPECT_EQ(ptr, secondPtr);
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, driverHandle->freeMem(ptr));
+    EXPECT_EQ(1u, driverHandle->getIpcImportsCount());
+    EXPECT_NE(nullptr, driverHandle->getSvmAllocsManager()->getSVMAlloc(ptr));
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, driverHandle->freeMem(ptr));
+    EXPECT_EQ(0u, driverHandle->getIpcImportsCount());
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, driverHandle->closeIpcMemHandle(ptr));
+}
+
 using DeviceMemorySizeTest = Test<DeviceFixture>;
 
 TEST_F(DeviceMemorySizeTest, givenSizeGreaterThanLimitThenDeviceAllocationFails) {
@@ -49,6 +49,72 @@ HWTEST_F(ModuleTest, givenKernelCreateReturnsSuccess) {
     Kernel::fromHandle(kernelHandle)->destroy();
 }
 
+HWTEST_F(ModuleTest, givenLazyKernelInitializationWhenKernelIsCreatedThenOnlyItsImmutableDataIsInitialized) {
+    DebugManagerStateRestore restorer;
+    NEO::DebugManager.flags.EnableLazyKernelInitialization.set(true);
+    createModuleFromBinary();
+
+    auto whiteboxModule = whitebox_cast(module.get());
+    for (auto &kernelImmData : whiteboxModule->kernelImmDatas) {
+        EXPECT_FALSE(kernelImmData->isInitialized());
+        EXPECT_EQ(nullptr, kernelImmData->getIsaGraphicsAllocation());
+    }
+
+    ze_kernel_handle_t kernelHandle;
+    ze_kernel_desc_t kernelDesc = {};
+    kernelDesc.pKernelName = kernelName.c_str();
+    ze_result_t res = module->createKernel(&kernelDesc, &kernelHandle);
+    ASSERT_EQ(ZE_RESULT_SUCCESS, res);
+
+    auto kernelImmData = module->getKernelImmutableData(kernelName.c_str());
+    EXPECT_EQ(kernelImmData, Kernel::fromHandle(kernelHandle)->getImmutableData());
+    EXPECT_TRUE(kernelImmData->isInitialized());
+    EXPECT_NE(nullptr, kernelImmData->getIsaGraphicsAllocation());
+    for (auto &otherKernelImmData : whiteboxModule->kernelImmDatas) {
+        if (otherKernelImmData.get() != kernelImmData) {
+            EXPECT_FALSE(otherKernelImmData->isInitialized());
+        }
+    }
+
+    Kernel::fromHandle(kernelHandle)->destroy();
+}
+
+struct ModuleSharedIsaPoolFixture : public ModuleFixture {
+    void SetUp() override {
+        NEO::DebugManager.flags.EnableSharedIsaPool.set(true);
+        ModuleFixture::SetUp();
+    }
+
+    DebugManagerStateRestore restorer;
+};
+using ModuleSharedIsaPoolTest = Test<ModuleSharedIsaPoolFixture>;
+
+HWTEST_F(ModuleSharedIsaPoolTest, givenKernelCreatedWhenIsaIsPackedInPoolAllocationThenIsaIsCopiedAtItsOffset) {
+    ze_kernel_handle_t kernelHandle;
+    ze_kernel_desc_t kernelDesc = {};
+    kernelDesc.pKernelName = kernelName.c_str();
+    ze_result_t res = module->createKernel(&kernelDesc, &kernelHandle);
+    ASSERT_EQ(ZE_RESULT_SUCCESS, res);
+
+    auto kernel = static_cast<KernelImp *>(Kernel::fromHandle(kernelHandle));
+    auto kernelImmData = kernel->getImmutableData();
+    NEO::KernelInfo *kernelInfo = nullptr;
+    for (auto ki : whitebox_cast(module.get())->translationUnit->programInfo.kernelInfos) {
+        if (ki->kernelDescriptor.kernelMetadata.kernelName == kernelName) {
+            kernelInfo = ki;
+        }
+    }
+    ASSERT_NE(nullptr, kernelInfo);
+
+    EXPECT_EQ(kernelInfo->heapInfo.KernelHeapSize, kernelImmData->getIsaSize());
+    EXPECT_EQ(kernelImmData->getIsaGraphicsAllocation(), kernel->getIsaAllocation());
+    EXPECT_EQ(kernelImmData->getIsaOffsetInParentAllocation(), kernel->getIsaOffsetInParentAllocation());
+    auto isa = ptrOffset(kernelImmData->getIsaGraphicsAllocation()->getUnderlyingBuffer(), static_cast<size_t>(kernelImmData->getIsaOffsetInParentAllocation()));
+    EXPECT_EQ(0, memcmp(isa, kernelInfo->heapInfo.pKernelHeap, kernelInfo->heapInfo.KernelHeapSize));
+
+    kernel->destroy();
+}
+
 HWTEST_F(ModuleTest, givenZeroCountWhenGettingKernelNamesThenCountIsFilled) {
     uint32_t count = 0;
     auto result = module->getKernelNames(&count, nullptr);
@@ -11,6 +11,7 @@
 #include "shared/source/helpers/debug_helpers.h"
 
 #include "level_zero/tools/source/sysman/engine/engine_imp.h"
+#include "level_zero/tools/source/sysman/telemetry_sampler.h"
 class OsEngine;
 namespace L0 {
 
@@ -42,6 +43,28 @@ void EngineHandleContext::releaseEngines() {
     handleList.clear();
 }
 
+void EngineHandleContext::enableTelemetrySampling(TelemetrySampler &sampler) {
+    if (handleList.empty()) {
+        return;
+    }
+    // All engines are sampled at once, so their activity shares one read of the event group
+    uint32_t firstMetric = sampler.addMetrics(static_cast<uint32_t>(handleList.size()), [this](std::vector<TelemetrySample> &samples) {
+        std::vector<zes_engine_stats_t> stats;
+        ze_result_t result = engineGetActivitySnapshot(stats);
+        if (ZE_RESULT_SUCCESS != result) {
+            return result;
+        }
+        for (size_t i = 0; i < stats.size(); i++) {
+            samples[i].value = stats[i].activeTime;
+            samples[i].timestamp = stats[i].timestamp;
+        }
+        return result;
+    });
+    for (uint32_t i = 0; i < handleList.size(); i++) {
+        static_cast<EngineImp *>(handleList[i])->enableTelemetrySampling(sampler, firstMetric + i);
+    }
+}
+
 ze_result_t EngineHandleContext::engineGet(uint32_t *pCount, zes_engine_handle_t *phEngine) {
     uint32_t handleListSize = static_cast<uint32_t>(handleList.size());
     uint32_t numToCopy = std::min(*pCount, handleListSize);
@@ -56,4 +79,12 @@ ze_result_t EngineHandleContext::engineGet(uint32_t *pCount, zes_engine_handle_t
     return ZE_RESULT_SUCCESS;
 }
 
+ze_result_t EngineHandleContext::engineGetActivitySnapshot(std::vector<zes_engine_stats_t> &stats) {
+    std::vector<OsEngine *> osEngines;
+    for (Engine *pEngine : handleList) {
+        osEngines.push_back(static_cast<EngineImp *>(pEngine)->pOsEngine);
+    }
+    return OsEngine::getActivitySnapshot(osEngines, stats);
+}
+
 } // namespace L0
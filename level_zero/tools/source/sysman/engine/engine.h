@@ -18,6 +18,7 @@ struct _zes_engine_handle_t {
 namespace L0 {
 
 struct OsSysman;
+class TelemetrySampler;
 
 class Engine : _zes_engine_handle_t {
   public:
@@ -36,8 +37,10 @@ struct EngineHandleContext {
 
     void init();
     void releaseEngines();
+    void enableTelemetrySampling(TelemetrySampler &sampler);
 
     ze_result_t engineGet(uint32_t *pCount, zes_engine_handle_t *phEngine);
+    ze_result_t engineGetActivitySnapshot(std::vector<zes_engine_stats_t> &stats);
 
     OsSysman *pOsSysman = nullptr;
     std::vector<Engine *> handleList = {};
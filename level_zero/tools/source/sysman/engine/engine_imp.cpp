@@ -8,9 +8,18 @@
 #include "level_zero/tools/source/sysman/engine/engine_imp.h"
 
 #include "shared/source/helpers/debug_helpers.h"
+
+#include "level_zero/tools/source/sysman/telemetry_sampler.h"
 namespace L0 {
 
 ze_result_t EngineImp::engineGetActivity(zes_engine_stats_t *pStats) {
+    TelemetrySample sample;
+    if ((nullptr != pTelemetrySampler) && pTelemetrySampler->isRunning() &&
+        pTelemetrySampler->getLatestSample(activityMetric, sample)) {
+        pStats->activeTime = sample.value;
+        pStats->timestamp = sample.timestamp;
+        return ZE_RESULT_SUCCESS;
+    }
     return pOsEngine->getActivity(pStats);
 }
 
@@ -19,6 +28,11 @@ ze_result_t EngineImp::engineGetProperties(zes_engine_properties_t *pProperties)
     return ZE_RESULT_SUCCESS;
 }
 
+void EngineImp::enableTelemetrySampling(const TelemetrySampler &sampler, uint32_t metric) {
+    pTelemetrySampler = &sampler;
+    activityMetric = metric;
+}
+
 void EngineImp::init() {
     pOsEngine->getProperties(engineProperties);
 }
@@ -25,6 +25,11 @@ class EngineImp : public Engine, NEO::NonCopyableOrMovableClass {
 
     OsEngine *pOsEngine = nullptr;
     void init();
+    void enableTelemetrySampling(const TelemetrySampler &sampler, uint32_t metric);
+
+  protected:
+    const TelemetrySampler *pTelemetrySampler = nullptr;
+    uint32_t activityMetric = 0;
 
   private:
     zes_engine_properties_t engineProperties = {};
@@ -44,10 +44,44 @@ ze_result_t OsEngine::getNumEngineTypeAndInstances(std::multimap<zes_engine_grou
     return ZE_RESULT_SUCCESS;
 }
 
+ze_result_t OsEngine::getActivitySnapshot(const std::vector<OsEngine *> &osEngines, std::vector<zes_engine_stats_t> &stats) {
+    // Engines of one event group are sampled by a single read and share its timestamp
+    LinuxEngineImp::GroupSamples groupSamples;
+    stats.assign(osEngines.size(), {});
+    for (size_t i = 0; i < osEngines.size(); i++) {
+        ze_result_t result = static_cast<LinuxEngineImp *>(osEngines[i])->getActivity(&stats[i], groupSamples);
+        if (ZE_RESULT_SUCCESS != result) {
+            return result;
+        }
+    }
+    return ZE_RESULT_SUCCESS;
+}
+
 ze_result_t LinuxEngineImp::getActivity(zes_engine_stats_t *pStats) {
+    GroupSamples groupSamples;
+    return getActivity(pStats, groupSamples);
+}
+
+ze_result_t LinuxEngineImp::getActivity(zes_engine_stats_t *pStats, GroupSamples &groupSamples) {
     if (fd < 0) {
         return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
+    if (pEventGroup) {
+        auto sample = groupSamples.find(pEventGroup.get());
+        if (sample == groupSamples.end()) {
+            PmuEventGroup::Sample newSample;
+            if (pEventGroup->read(newSample) < 0) {
+                return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+            }
+            sample = groupSamples.insert({pEventGroup.get(), std::move(newSample)}).first;
+        }
+        if (indexInEventGroup >= sample->second.values.size()) {
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+        }
+        pStats->activeTime = sample->second.values[indexInEventGroup] / microSecondsToNanoSeconds;
+        pStats->timestamp = sample->second.timestamp / microSecondsToNanoSeconds;
+        return ZE_RESULT_SUCCESS;
+    }
     uint64_t data[2] = {};
     if (pPmuInterface->pmuReadSingle(static_cast<int>(fd), data, sizeof(data)) < 0) {
         return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
@@ -65,10 +99,17 @@ ze_result_t LinuxEngineImp::getProperties(zes_engine_properties_t &properties) {
     return ZE_RESULT_SUCCESS;
 }
 
-void LinuxEngineImp::init() {
+void LinuxEngineImp::init(LinuxSysmanImp *pLinuxSysmanImp) {
     auto i915EngineClass = engineToI915Map.find(engineGroup);
     // I915_PMU_ENGINE_BUSY macro provides the perf type config which we want to listen to get the engine busyness.
-    fd = pPmuInterface->pmuInterfaceOpen(I915_PMU_ENGINE_BUSY(i915EngineClass->second, engineInstance), -1, PERF_FORMAT_TOTAL_TIME_ENABLED);
+    auto config = I915_PMU_ENGINE_BUSY(i915EngineClass->second, engineInstance);
+    pEventGroup = pLinuxSysmanImp->getEngineEventGroup();
+    fd = pEventGroup->addEvent(config, indexInEventGroup);
+    if (fd < 0) {
+        // Engine which cannot join the group is still sampled on its own
+        pEventGroup.reset();
+        fd = pPmuInterface->pmuInterfaceOpen(config, -1, PERF_FORMAT_TOTAL_TIME_ENABLED);
+    }
 }
 
 LinuxEngineImp::LinuxEngineImp(OsSysman *pOsSysman, zes_engine_group_t type, uint32_t engineInstance) : engineGroup(type), engineInstance(engineInstance) {
@@ -76,7 +117,7 @@ LinuxEngineImp::LinuxEngineImp(OsSysman *pOsSysman, zes_engine_group_t type, uin
     pDrm = &pLinuxSysmanImp->getDrm();
     pDevice = pLinuxSysmanImp->getDeviceHandle();
     pPmuInterface = pLinuxSysmanImp->getPmuInterface();
-    init();
+    init(pLinuxSysmanImp);
 }
 
 OsEngine *OsEngine::create(OsSysman *pOsSysman, zes_engine_group_t type, uint32_t engineInstance) {
@@ -12,20 +12,29 @@
 #include "level_zero/tools/source/sysman/sysman_const.h"
 
 #include "sysman/engine/os_engine.h"
+#include "sysman/linux/pmu/pmu.h"
+
+#include <map>
+#include <memory>
+
 namespace L0 {
-class PmuInterface;
+class LinuxSysmanImp;
 struct Device;
 class LinuxEngineImp : public OsEngine, NEO::NonCopyableOrMovableClass {
   public:
+    using GroupSamples = std::map<PmuEventGroup *, PmuEventGroup::Sample>;
+
     ze_result_t getActivity(zes_engine_stats_t *pStats) override;
+    ze_result_t getActivity(zes_engine_stats_t *pStats, GroupSamples &groupSamples);
     ze_result_t getProperties(zes_engine_properties_t &properties) override;
     LinuxEngineImp() = default;
     LinuxEngineImp(OsSysman *pOsSysman, zes_engine_group_t type, uint32_t engineInstance);
     ~LinuxEngineImp() override {
-        if (fd != -1) {
+        // Descriptor opened in the event group is closed by the group once its last engine is gone
+        if (fd >= 0 && !pEventGroup) {
             close(static_cast<int>(fd));
-            fd = -1;
         }
+        fd = -1;
     }
 
   protected:
@@ -34,9 +43,11 @@ class LinuxEngineImp : public OsEngine, NEO::NonCopyableOrMovableClass {
     PmuInterface *pPmuInterface = nullptr;
     NEO::Drm *pDrm = nullptr;
     Device *pDevice = nullptr;
+    std::shared_ptr<PmuEventGroup> pEventGroup;
+    uint32_t indexInEventGroup = 0;
 
   private:
-    void init();
+    void init(LinuxSysmanImp *pLinuxSysmanImp);
     int64_t fd = -1;
 };
 
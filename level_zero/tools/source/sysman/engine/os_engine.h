@@ -10,6 +10,7 @@
 #include <level_zero/zes_api.h>
 
 #include <map>
+#include <vector>
 
 namespace L0 {
 
@@ -22,6 +23,7 @@ class OsEngine {
     virtual ze_result_t getProperties(zes_engine_properties_t &properties) = 0;
     static OsEngine *create(OsSysman *pOsSysman, zes_engine_group_t engineType, uint32_t engineInstance);
     static ze_result_t getNumEngineTypeAndInstances(std::multimap<zes_engine_group_t, uint32_t> &engineGroupInstance, OsSysman *pOsSysman);
+    static ze_result_t getActivitySnapshot(const std::vector<OsEngine *> &osEngines, std::vector<zes_engine_stats_t> &stats);
     virtual ~OsEngine() = default;
 };
 
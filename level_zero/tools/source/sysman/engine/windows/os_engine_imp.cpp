@@ -66,6 +66,17 @@ OsEngine *OsEngine::create(OsSysman *pOsSysman, zes_engine_group_t engineType, u
     return static_cast<OsEngine *>(pWddmEngineImp);
 }
 
+ze_result_t OsEngine::getActivitySnapshot(const std::vector<OsEngine *> &osEngines, std::vector<zes_engine_stats_t> &stats) {
+    stats.assign(osEngines.size(), {});
+    for (size_t i = 0; i < osEngines.size(); i++) {
+        ze_result_t status = osEngines[i]->getActivity(&stats[i]);
+        if (status != ZE_RESULT_SUCCESS) {
+            return status;
+        }
+    }
+    return ZE_RESULT_SUCCESS;
+}
+
 ze_result_t OsEngine::getNumEngineTypeAndInstances(std::multimap<zes_engine_group_t, uint32_t> &engineGroupInstance, OsSysman *pOsSysman) {
     WddmSysmanImp *pWddmSysmanImp = static_cast<WddmSysmanImp *>(pOsSysman);
     KmdSysManager *pKmdSysManager = &pWddmSysmanImp->getKmdSysManager();
@@ -11,10 +11,12 @@
 #include "level_zero/tools/source/sysman/global_operations/global_operations_imp.h"
 #include "level_zero/tools/source/sysman/linux/fs_access.h"
 #include "level_zero/tools/source/sysman/sysman_const.h"
+#include "level_zero/tools/source/sysman/telemetry_sampler.h"
 #include <level_zero/zet_api.h>
 
 #include <chrono>
 #include <csignal>
+#include <set>
 #include <time.h>
 
 namespace L0 {
@@ -174,7 +176,12 @@ ze_result_t LinuxGlobalOperationsImp::reset(ze_bool_t force) {
         }
     }
 
-    pLinuxSysmanImp->getSysmanDeviceImp()->pEngineHandleContext->releaseEngines();
+    auto pSysmanDeviceImp = pLinuxSysmanImp->getSysmanDeviceImp();
+    if (pSysmanDeviceImp->pTelemetrySampler) {
+        // Sampler reads engines released below, queries fall back to reading hardware directly
+        pSysmanDeviceImp->pTelemetrySampler->stop();
+    }
+    pSysmanDeviceImp->pEngineHandleContext->releaseEngines();
     static_cast<DeviceImp *>(getDevice())->releaseResources();
     for (auto &&fd : myPidFds) {
         // Close open filedescriptors to the device
@@ -232,6 +239,13 @@ ze_result_t LinuxGlobalOperationsImp::reset(ze_bool_t force) {
     if (ZE_RESULT_SUCCESS != result) {
         return result;
     }
+    // Files kept open for reading belong to the device instance that was just reset
+    pFsAccess->invalidateCachedFiles();
+    // Drm clients do not survive the reset
+    {
+        std::lock_guard<std::mutex> lock(clientsCacheMutex);
+        clientsCache.clear();
+    }
 
     // Rebind the device to the kernel driver.
     result = pSysfsAccess->bindDevice(resetName);
@@ -259,6 +273,8 @@ ze_result_t LinuxGlobalOperationsImp::reset(ze_bool_t force) {
 // accumulated nanoseconds each client spent on engines.
 // Thus we traverse each file in busy dir for non-zero time and if we find that file say 0,then we could say that
 // this engine 0 is used by process.
+// Engines found in use are remembered per client, so repeated scans only read the busy files of engines
+// a client has not used yet, the pid and the memory counters.
 ze_result_t LinuxGlobalOperationsImp::scanProcessesState(std::vector<zes_process_state_t> &pProcessList) {
     std::vector<std::string> clientIds;
     struct deviceMemStruct {
@@ -275,6 +291,17 @@ ze_result_t LinuxGlobalOperationsImp::scanProcessesState(std::vector<zes_process
         return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    std::lock_guard<std::mutex> lock(clientsCacheMutex);
+    // Forget clients that closed their drm connection since the previous scan
+    std::set<std::string> currentClientIds(clientIds.begin(), clientIds.end());
+    for (auto cachedClient = clientsCache.begin(); cachedClient != clientsCache.end();) {
+        if (currentClientIds.find(cachedClient->first) == currentClientIds.end()) {
+            cachedClient = clientsCache.erase(cachedClient);
+        } else {
+            ++cachedClient;
+        }
+    }
+
     // Create a map with unique pid as key and engineType as value
     std::map<uint64_t, engineMemoryPairType> pidClientMap;
     for (const auto &clientId : clientIds) {
@@ -284,49 +311,63 @@ ze_result_t LinuxGlobalOperationsImp::scanProcessesState(std::vector<zes_process
         result = pSysfsAccess->read(realClientPidPath, pid);
         if (ZE_RESULT_SUCCESS != result) {
             if (ZE_RESULT_ERROR_NOT_AVAILABLE == result) {
+                clientsCache.erase(clientId);
                 continue;
             } else {
                 return result;
             }
         }
 
-        // Traverse the clients/<clientId>/busy directory to get accelerator engines used by process
-        std::vector<std::string> engineNums;
         std::string busyDirForEngines = clientsDir + "/" + clientId + "/" + "busy";
-        result = pSysfsAccess->scanDirEntries(busyDirForEngines, engineNums);
-        if (ZE_RESULT_SUCCESS != result) {
-            if (ZE_RESULT_ERROR_NOT_AVAILABLE == result) {
-                continue;
-            } else {
-                return result;
+        auto cachedClient = clientsCache.find(clientId);
+        if ((cachedClient == clientsCache.end()) || (cachedClient->second.pid != pid)) {
+            // New client, or client id now used by another process.
+            // Traverse the clients/<clientId>/busy directory to get accelerator engines used by process
+            clientsCache.erase(clientId);
+            ClientState clientState;
+            clientState.pid = pid;
+            result = pSysfsAccess->scanDirEntries(busyDirForEngines, clientState.idleEngines);
+            if (ZE_RESULT_SUCCESS != result) {
+                if (ZE_RESULT_ERROR_NOT_AVAILABLE == result) {
+                    continue;
+                } else {
+                    return result;
+                }
             }
+            cachedClient = clientsCache.insert(std::make_pair(clientId, std::move(clientState))).first;
         }
-        int64_t engineType = 0;
-        // Scan all engine files present in /sys/class/drm/card0/clients/<ClientId>/busy and check
-        // whether that engine is used by process
-        for (const auto &engineNum : engineNums) {
+        auto &clientState = cachedClient->second;
+
+        // Check whether engines in /sys/class/drm/card0/clients/<ClientId>/busy are used by process.
+        // Busy time only accumulates, so engines already found in use are not read again.
+        for (auto engineNum = clientState.idleEngines.begin(); engineNum != clientState.idleEngines.end();) {
             uint64_t timeSpent = 0;
-            std::string engine = busyDirForEngines + "/" + engineNum;
+            std::string engine = busyDirForEngines + "/" + *engineNum;
             result = pSysfsAccess->read(engine, timeSpent);
             if (ZE_RESULT_SUCCESS != result) {
                 if (ZE_RESULT_ERROR_NOT_AVAILABLE == result) {
+                    ++engineNum;
                     continue;
                 } else {
                     return result;
                 }
             }
-            if (timeSpent > 0) {
-                int i915EnginNumber = stoi(engineNum);
-                auto i915MapToL0EngineType = engineMap.find(i915EnginNumber);
-                zes_engine_type_flags_t val = ZES_ENGINE_TYPE_FLAG_OTHER;
-                if (i915MapToL0EngineType != engineMap.end()) {
-                    // Found a valid map
-                    val = i915MapToL0EngineType->second;
-                }
-                // In this for loop we want to retrieve the overall engines used by process
-                engineType = engineType | val;
+            if (timeSpent == 0) {
+                ++engineNum;
+                continue;
+            }
+            int i915EnginNumber = stoi(*engineNum);
+            auto i915MapToL0EngineType = engineMap.find(i915EnginNumber);
+            zes_engine_type_flags_t val = ZES_ENGINE_TYPE_FLAG_OTHER;
+            if (i915MapToL0EngineType != engineMap.end()) {
+                // Found a valid map
+                val = i915MapToL0EngineType->second;
             }
+            // In this for loop we want to retrieve the overall engines used by process
+            clientState.engineType = clientState.engineType | val;
+            engineNum = clientState.idleEngines.erase(engineNum);
         }
+        int64_t engineType = clientState.engineType;
 
         uint64_t memSize = 0;
         std::string realClientTotalMemoryPath = clientsDir + "/" + clientId + "/" + "total_device_memory_buffer_objects" + "/" + "created_bytes";
@@ -9,6 +9,11 @@
 #include "level_zero/tools/source/sysman/global_operations/os_global_operations.h"
 #include "level_zero/tools/source/sysman/linux/os_sysman_imp.h"
 
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
 namespace L0 {
 class SysfsAccess;
 struct Device;
@@ -35,6 +40,17 @@ class LinuxGlobalOperationsImp : public OsGlobalOperations, NEO::NonCopyableOrMo
     LinuxSysmanImp *pLinuxSysmanImp = nullptr;
     Device *pDevice = nullptr;
 
+    struct ClientState {
+        uint64_t pid = 0;
+        int64_t engineType = 0;
+        // Engines in clients/<clientId>/busy on which the client has not run yet
+        std::vector<std::string> idleEngines;
+    };
+    // State of drm clients found by previous scans, keyed by client id
+    std::map<std::string, ClientState> clientsCache;
+    // Guards clientsCache, processes may be scanned and device reset from different threads
+    std::mutex clientsCacheMutex;
+
   private:
     static const int resetTimeout = 10;
 
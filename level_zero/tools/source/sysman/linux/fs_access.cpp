@@ -14,6 +14,8 @@
 #include <cstdio>
 #include <cstdlib>
 #include <dirent.h>
+#include <fcntl.h>
+#include <limits>
 #include <unistd.h>
 
 namespace L0 {
@@ -28,80 +30,163 @@ static ze_result_t getResult(int err) {
     }
 }
 
-// Generic Filesystem Access
-FsAccess::FsAccess() {
+static bool parseValue(const char *str, uint64_t &val) {
+    char *end = nullptr;
+    errno = 0;
+    auto parsed = std::strtoull(str, &end, 10);
+    if ((end == str) || (ERANGE == errno)) {
+        return false;
+    }
+    val = static_cast<uint64_t>(parsed);
+    return true;
 }
 
-FsAccess *FsAccess::create() {
-    return new FsAccess();
+static bool parseValue(const char *str, uint32_t &val) {
+    uint64_t parsed = 0;
+    if (!parseValue(str, parsed) || (parsed > std::numeric_limits<uint32_t>::max())) {
+        return false;
+    }
+    val = static_cast<uint32_t>(parsed);
+    return true;
 }
 
-ze_result_t FsAccess::read(const std::string file, uint64_t &val) {
-    // Read a single line from text file without trailing newline
-    std::ifstream fs;
-
-    fs.open(file.c_str());
-    if (fs.fail()) {
-        return getResult(errno);
-    }
-    fs >> val;
-    if (fs.fail()) {
-        fs.close();
-        return getResult(errno);
+static bool parseValue(const char *str, int32_t &val) {
+    char *end = nullptr;
+    errno = 0;
+    auto parsed = std::strtoll(str, &end, 10);
+    if ((end == str) || (ERANGE == errno) ||
+        (parsed < std::numeric_limits<int32_t>::min()) || (parsed > std::numeric_limits<int32_t>::max())) {
+        return false;
     }
-    fs.close();
-    return ZE_RESULT_SUCCESS;
+    val = static_cast<int32_t>(parsed);
+    return true;
 }
 
-ze_result_t FsAccess::read(const std::string file, double &val) {
-    // Read a single line from text file without trailing newline
-    std::ifstream fs;
+static bool parseValue(const char *str, double &val) {
+    char *end = nullptr;
+    errno = 0;
+    auto parsed = std::strtod(str, &end);
+    if ((end == str) || (ERANGE == errno)) {
+        return false;
+    }
+    val = parsed;
+    return true;
+}
 
-    fs.open(file.c_str());
-    if (fs.fail()) {
-        return getResult(errno);
+template <typename T>
+static ze_result_t readValue(FileDescriptorCache &cache, const std::string &file, T &val) {
+    // Numeric sysfs entries are short, parse them from a stack buffer
+    std::array<char, 64> buffer;
+    size_t bytesRead = 0;
+    ze_result_t result = cache.readFromStart(file, buffer.data(), buffer.size() - 1, bytesRead);
+    if (ZE_RESULT_SUCCESS != result) {
+        return result;
     }
-    fs >> val;
-    if (fs.fail()) {
-        fs.close();
-        return getResult(errno);
+    buffer[bytesRead] = '\0';
+    if (!parseValue(buffer.data(), val)) {
+        return ZE_RESULT_ERROR_UNKNOWN;
     }
-    fs.close();
     return ZE_RESULT_SUCCESS;
 }
 
-ze_result_t FsAccess::read(const std::string file, int32_t &val) {
-    // Read a single line from text file without trailing newline
-    std::ifstream fs;
+// Cache of open file descriptors
+FileDescriptorCache::~FileDescriptorCache() {
+    invalidateAll();
+}
 
-    fs.open(file.c_str());
-    if (fs.fail()) {
-        return getResult(errno);
+int FileDescriptorCache::openFile(const std::string &file, bool &cached) {
+    auto it = fileDescriptors.find(file);
+    if (it != fileDescriptors.end()) {
+        cached = true;
+        return it->second;
     }
-    fs >> val;
-    if (fs.fail()) {
-        fs.close();
-        return getResult(errno);
+    int fd = ::open(file.c_str(), O_RDONLY | O_CLOEXEC);
+    cached = (fd >= 0) && (fileDescriptors.size() < maxCachedFileDescriptors);
+    if (cached) {
+        fileDescriptors[file] = fd;
     }
-    fs.close();
-    return ZE_RESULT_SUCCESS;
+    return fd;
 }
 
-ze_result_t FsAccess::read(const std::string file, uint32_t &val) {
-    // Read a single line from text file without trailing newline
-    std::ifstream fs;
+ze_result_t FileDescriptorCache::readFromStart(const std::string &file, char *buffer, size_t bufferSize, size_t &bytesRead) {
+    std::lock_guard<std::mutex> lock(mtx);
+    int err = ENODEV;
+    // Retry once with fresh descriptors when the device went away under the cached ones
+    for (uint32_t attempt = 0; attempt < 2; attempt++) {
+        bool cached = false;
+        int fd = openFile(file, cached);
+        if (fd < 0) {
+            return getResult(errno);
+        }
+        ssize_t len = ::pread(fd, buffer, bufferSize, 0);
+        err = errno;
+        if (!cached) {
+            ::close(fd);
+        }
+        if (len >= 0) {
+            bytesRead = static_cast<size_t>(len);
+            return ZE_RESULT_SUCCESS;
+        }
+        if (ENODEV != err) {
+            if (cached) {
+                ::close(fd);
+                fileDescriptors.erase(file);
+            }
+            return getResult(err);
+        }
+        // Device reset or unbind invalidates every descriptor opened before it
+        for (auto &fileDescriptor : fileDescriptors) {
+            ::close(fileDescriptor.second);
+        }
+        fileDescriptors.clear();
+    }
+    return getResult(err);
+}
 
-    fs.open(file.c_str());
-    if (fs.fail()) {
-        return getResult(errno);
+void FileDescriptorCache::invalidate(const std::string &file) {
+    std::lock_guard<std::mutex> lock(mtx);
+    auto it = fileDescriptors.find(file);
+    if (it != fileDescriptors.end()) {
+        ::close(it->second);
+        fileDescriptors.erase(it);
     }
-    fs >> val;
-    if (fs.fail()) {
-        fs.close();
-        return getResult(errno);
+}
+
+void FileDescriptorCache::invalidateAll() {
+    std::lock_guard<std::mutex> lock(mtx);
+    for (auto &fileDescriptor : fileDescriptors) {
+        ::close(fileDescriptor.second);
     }
-    fs.close();
-    return ZE_RESULT_SUCCESS;
+    fileDescriptors.clear();
+}
+
+size_t FileDescriptorCache::getCachedFileDescriptorsCount() const {
+    std::lock_guard<std::mutex> lock(mtx);
+    return fileDescriptors.size();
+}
+
+// Generic Filesystem Access
+FsAccess::FsAccess() {
+}
+
+FsAccess *FsAccess::create() {
+    return new FsAccess();
+}
+
+ze_result_t FsAccess::read(const std::string file, uint64_t &val) {
+    return readValue(fileDescriptorCache, file, val);
+}
+
+ze_result_t FsAccess::read(const std::string file, double &val) {
+    return readValue(fileDescriptorCache, file, val);
+}
+
+ze_result_t FsAccess::read(const std::string file, int32_t &val) {
+    return readValue(fileDescriptorCache, file, val);
+}
+
+ze_result_t FsAccess::read(const std::string file, uint32_t &val) {
+    return readValue(fileDescriptorCache, file, val);
 }
 ze_result_t FsAccess::read(const std::string file, std::string &val) {
     // Read a single line from text file without trailing newline
@@ -280,6 +365,10 @@ bool FsAccess::fileExists(const std::string file) {
     return false;
 }
 
+void FsAccess::invalidateCachedFiles() {
+    fileDescriptorCache.invalidateAll();
+}
+
 // Procfs Access
 const std::string ProcfsAccess::procDir = "/proc/";
 const std::string ProcfsAccess::fdDir = "/fd/";
@@ -414,75 +503,23 @@ ze_result_t SysfsAccess::read(const std::string file, std::string &val) {
 }
 
 ze_result_t SysfsAccess::read(const std::string file, int32_t &val) {
-    std::string str;
-    ze_result_t result;
-
-    result = FsAccess::read(fullPath(file), str);
-    if (ZE_RESULT_SUCCESS != result) {
-        return result;
-    }
-
-    std::istringstream stream(str);
-    stream >> val;
-
-    if (stream.fail()) {
-        return ZE_RESULT_ERROR_UNKNOWN;
-    }
-    return ZE_RESULT_SUCCESS;
+    // Prepend sysfs directory path and call the base read
+    return FsAccess::read(fullPath(file), val);
 }
 
 ze_result_t SysfsAccess::read(const std::string file, uint32_t &val) {
-    std::string str;
-    ze_result_t result;
-
-    result = FsAccess::read(fullPath(file), str);
-    if (ZE_RESULT_SUCCESS != result) {
-        return result;
-    }
-
-    std::istringstream stream(str);
-    stream >> val;
-
-    if (stream.fail()) {
-        return ZE_RESULT_ERROR_UNKNOWN;
-    }
-    return ZE_RESULT_SUCCESS;
+    // Prepend sysfs directory path and call the base read
+    return FsAccess::read(fullPath(file), val);
 }
 
 ze_result_t SysfsAccess::read(const std::string file, double &val) {
-    std::string str;
-    ze_result_t result;
-
-    result = FsAccess::read(fullPath(file), str);
-    if (ZE_RESULT_SUCCESS != result) {
-        return result;
-    }
-
-    std::istringstream stream(str);
-    stream >> val;
-
-    if (stream.fail()) {
-        return ZE_RESULT_ERROR_UNKNOWN;
-    }
-    return ZE_RESULT_SUCCESS;
+    // Prepend sysfs directory path and call the base read
+    return FsAccess::read(fullPath(file), val);
 }
 
 ze_result_t SysfsAccess::read(const std::string file, uint64_t &val) {
-    std::string str;
-    ze_result_t result;
-
-    result = FsAccess::read(fullPath(file), str);
-    if (ZE_RESULT_SUCCESS != result) {
-        return result;
-    }
-
-    std::istringstream stream(str);
-    stream >> val;
-
-    if (stream.fail()) {
-        return ZE_RESULT_ERROR_UNKNOWN;
-    }
-    return ZE_RESULT_SUCCESS;
+    // Prepend sysfs directory path and call the base read
+    return FsAccess::read(fullPath(file), val);
 }
 
 ze_result_t SysfsAccess::read(const std::string file, std::vector<std::string> &val) {
@@ -541,10 +578,12 @@ ze_result_t SysfsAccess::getRealPath(const std::string path, std::string &val) {
 }
 
 ze_result_t SysfsAccess::bindDevice(std::string device) {
+    FsAccess::invalidateCachedFiles();
     return FsAccess::write(intelGpuBindEntry, device);
 }
 
 ze_result_t SysfsAccess::unbindDevice(std::string device) {
+    FsAccess::invalidateCachedFiles();
     return FsAccess::write(intelGpuUnbindEntry, device);
 }
 
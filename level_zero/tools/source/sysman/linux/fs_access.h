@@ -13,6 +13,8 @@
 #include <fstream>
 #include <iostream>
 #include <list>
+#include <map>
+#include <mutex>
 #include <sstream>
 #include <string>
 #include <sys/stat.h>
@@ -23,6 +25,29 @@
 
 namespace L0 {
 
+// Keeps frequently read files open, so repeated reads are a single pread from offset 0
+class FileDescriptorCache {
+  public:
+    static constexpr size_t maxCachedFileDescriptors = 64u;
+
+    FileDescriptorCache() = default;
+    // Copies start empty, so no descriptor is ever closed twice
+    FileDescriptorCache(const FileDescriptorCache &) {}
+    FileDescriptorCache &operator=(const FileDescriptorCache &) { return *this; }
+    ~FileDescriptorCache();
+
+    ze_result_t readFromStart(const std::string &file, char *buffer, size_t bufferSize, size_t &bytesRead);
+    void invalidate(const std::string &file);
+    void invalidateAll();
+    size_t getCachedFileDescriptorsCount() const;
+
+  protected:
+    int openFile(const std::string &file, bool &cached);
+
+    std::map<std::string, int> fileDescriptors;
+    mutable std::mutex mtx;
+};
+
 class FsAccess {
   public:
     static FsAccess *create();
@@ -48,9 +73,12 @@ class FsAccess {
     std::string getBaseName(const std::string path);
     std::string getDirName(const std::string path);
     virtual bool fileExists(const std::string file);
+    void invalidateCachedFiles();
 
   protected:
     FsAccess();
+
+    FileDescriptorCache fileDescriptorCache;
 };
 
 class ProcfsAccess : private FsAccess {
@@ -47,6 +47,15 @@ PmuInterface *LinuxSysmanImp::getPmuInterface() {
     return pPmuInterface;
 }
 
+std::shared_ptr<PmuEventGroup> LinuxSysmanImp::getEngineEventGroup() {
+    auto pEventGroup = engineEventGroup.lock();
+    if (nullptr == pEventGroup) {
+        pEventGroup = std::make_shared<PmuEventGroup>(getPmuInterface());
+        engineEventGroup = pEventGroup;
+    }
+    return pEventGroup;
+}
+
 XmlParser *LinuxSysmanImp::getXmlParser() {
     return pXmlParser;
 }
@@ -17,8 +17,11 @@
 #include "level_zero/tools/source/sysman/linux/xml_parser/xml_parser.h"
 #include "level_zero/tools/source/sysman/sysman_imp.h"
 
+#include <memory>
+
 namespace L0 {
 class PmuInterface;
+class PmuEventGroup;
 
 class LinuxSysmanImp : public OsSysman, NEO::NonCopyableOrMovableClass {
   public:
@@ -29,6 +32,7 @@ class LinuxSysmanImp : public OsSysman, NEO::NonCopyableOrMovableClass {
 
     XmlParser *getXmlParser();
     PmuInterface *getPmuInterface();
+    std::shared_ptr<PmuEventGroup> getEngineEventGroup();
     FsAccess &getFsAccess();
     ProcfsAccess &getProcfsAccess();
     SysfsAccess &getSysfsAccess();
@@ -46,6 +50,8 @@ class LinuxSysmanImp : public OsSysman, NEO::NonCopyableOrMovableClass {
     NEO::Drm *pDrm = nullptr;
     Device *pDevice = nullptr;
     PmuInterface *pPmuInterface = nullptr;
+    // Shared by all engine handles, released together with the last of them
+    std::weak_ptr<PmuEventGroup> engineEventGroup;
 
   private:
     LinuxSysmanImp() = delete;
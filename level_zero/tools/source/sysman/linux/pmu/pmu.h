@@ -6,7 +6,11 @@
  */
 
 #pragma once
+#include "shared/source/helpers/non_copyable_or_moveable.h"
+
 #include <cstdint>
+#include <sys/types.h>
+#include <vector>
 
 namespace L0 {
 class LinuxSysmanImp;
@@ -18,4 +22,26 @@ class PmuInterface {
     static PmuInterface *create(LinuxSysmanImp *pLinuxSysmanImp);
 };
 
+// Events opened into one perf event group are read together with a single syscall.
+// Group owns descriptors of its events, so that indices of events never change while it is alive.
+class PmuEventGroup : NEO::NonCopyableOrMovableClass {
+  public:
+    struct Sample {
+        uint64_t timestamp = 0;
+        std::vector<uint64_t> values;
+    };
+
+    PmuEventGroup(PmuInterface *pPmuInterface) : pPmuInterface(pPmuInterface) {}
+    ~PmuEventGroup();
+
+    int64_t addEvent(uint64_t config, uint32_t &index);
+    int read(Sample &sample);
+    uint32_t getEventsCount() const { return static_cast<uint32_t>(eventFds.size()); }
+
+  protected:
+    PmuInterface *pPmuInterface = nullptr;
+    // First event is the group leader
+    std::vector<int64_t> eventFds;
+};
+
 } // namespace L0
\ No newline at end of file
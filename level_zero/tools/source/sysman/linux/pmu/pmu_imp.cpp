@@ -81,6 +81,43 @@ int PmuInterfaceImp::pmuReadSingle(int fd, uint64_t *data, ssize_t sizeOfdata) {
     return 0;
 }
 
+PmuEventGroup::~PmuEventGroup() {
+    // Leader is closed last
+    for (auto fd = eventFds.rbegin(); fd != eventFds.rend(); ++fd) {
+        close(static_cast<int>(*fd));
+    }
+    eventFds.clear();
+}
+
+int64_t PmuEventGroup::addEvent(uint64_t config, uint32_t &index) {
+    // Reading the group leader returns values of all events in the group
+    int group = eventFds.empty() ? -1 : static_cast<int>(eventFds[0]);
+    int64_t fd = pPmuInterface->pmuInterfaceOpen(config, group, PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_GROUP);
+    if (fd < 0) {
+        return fd;
+    }
+    index = static_cast<uint32_t>(eventFds.size());
+    eventFds.push_back(fd);
+    return fd;
+}
+
+int PmuEventGroup::read(Sample &sample) {
+    if (eventFds.empty()) {
+        return -1;
+    }
+    // Group read format: number of events, time enabled, then value of each event
+    std::vector<uint64_t> data(2 + eventFds.size());
+    if (pPmuInterface->pmuReadSingle(static_cast<int>(eventFds[0]), data.data(), static_cast<ssize_t>(data.size() * sizeof(uint64_t))) < 0) {
+        return -1;
+    }
+    if (data[0] != eventFds.size()) {
+        return -1;
+    }
+    sample.timestamp = data[1];
+    sample.values.assign(data.begin() + 2, data.end());
+    return 0;
+}
+
 PmuInterfaceImp::PmuInterfaceImp(LinuxSysmanImp *pLinuxSysmanImp) {
     pSysfsAccess = &pLinuxSysmanImp->getSysfsAccess();
     pFsAccess = &pLinuxSysmanImp->getFsAccess();
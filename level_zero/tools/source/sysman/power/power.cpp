@@ -28,6 +28,12 @@ void PowerHandleContext::init() {
     }
 }
 
+void PowerHandleContext::enableTelemetrySampling(TelemetrySampler &sampler) {
+    for (Power *pPower : handleList) {
+        static_cast<PowerImp *>(pPower)->enableTelemetrySampling(sampler);
+    }
+}
+
 ze_result_t PowerHandleContext::powerGet(uint32_t *pCount, zes_pwr_handle_t *phPower) {
     uint32_t handleListSize = static_cast<uint32_t>(handleList.size());
     uint32_t numToCopy = std::min(*pCount, handleListSize);
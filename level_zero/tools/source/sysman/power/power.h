@@ -21,6 +21,8 @@ struct _zes_pwr_handle_t {
 namespace L0 {
 
 struct OsSysman;
+class TelemetrySampler;
+
 class Power : _zet_sysman_pwr_handle_t, _zes_pwr_handle_t {
   public:
     virtual ze_result_t powerGetProperties(zes_power_properties_t *pProperties) = 0;
@@ -42,6 +44,7 @@ struct PowerHandleContext {
     ~PowerHandleContext();
 
     void init();
+    void enableTelemetrySampling(TelemetrySampler &sampler);
 
     ze_result_t powerGet(uint32_t *pCount, zes_pwr_handle_t *phPower);
 
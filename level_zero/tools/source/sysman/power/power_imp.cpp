@@ -9,6 +9,8 @@
 
 #include "shared/source/helpers/debug_helpers.h"
 
+#include "level_zero/tools/source/sysman/telemetry_sampler.h"
+
 namespace L0 {
 
 ze_result_t PowerImp::powerGetProperties(zes_power_properties_t *pProperties) {
@@ -17,6 +19,13 @@ ze_result_t PowerImp::powerGetProperties(zes_power_properties_t *pProperties) {
 }
 
 ze_result_t PowerImp::powerGetEnergyCounter(zes_power_energy_counter_t *pEnergy) {
+    TelemetrySample sample;
+    if ((nullptr != pTelemetrySampler) && pTelemetrySampler->isRunning() &&
+        pTelemetrySampler->getLatestSample(energyCounterMetric, sample)) {
+        pEnergy->energy = sample.value;
+        pEnergy->timestamp = sample.timestamp;
+        return ZE_RESULT_SUCCESS;
+    }
     return pOsPower->getEnergyCounter(pEnergy);
 }
 
@@ -49,6 +58,17 @@ void PowerImp::init() {
     }
 }
 
+void PowerImp::enableTelemetrySampling(TelemetrySampler &sampler) {
+    energyCounterMetric = sampler.addMetrics(1, [this](std::vector<TelemetrySample> &samples) {
+        zes_power_energy_counter_t energy = {};
+        ze_result_t result = pOsPower->getEnergyCounter(&energy);
+        samples[0].value = energy.energy;
+        samples[0].timestamp = energy.timestamp;
+        return result;
+    });
+    pTelemetrySampler = &sampler;
+}
+
 PowerImp::~PowerImp() {
     if (nullptr != pOsPower) {
         delete pOsPower;
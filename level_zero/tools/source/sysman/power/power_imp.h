@@ -28,5 +28,10 @@ class PowerImp : public Power, NEO::NonCopyableOrMovableClass {
 
     OsPower *pOsPower = nullptr;
     void init();
+    void enableTelemetrySampling(TelemetrySampler &sampler);
+
+  protected:
+    const TelemetrySampler *pTelemetrySampler = nullptr;
+    uint32_t energyCounterMetric = 0;
 };
 } // namespace L0
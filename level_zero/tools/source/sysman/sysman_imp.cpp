@@ -12,6 +12,7 @@
 #include "level_zero/tools/source/sysman/global_operations/global_operations_imp.h"
 #include "level_zero/tools/source/sysman/pci/pci_imp.h"
 #include "level_zero/tools/source/sysman/sysman.h"
+#include "level_zero/tools/source/sysman/telemetry_sampler.h"
 
 #include <vector>
 
@@ -37,6 +38,8 @@ SysmanDeviceImp::SysmanDeviceImp(ze_device_handle_t hDevice) {
 }
 
 SysmanDeviceImp::~SysmanDeviceImp() {
+    // Sampler thread reads through handles released below
+    freeResource(pTelemetrySampler);
     freeResource(pFanHandleContext);
     freeResource(pFirmwareHandleContext);
     freeResource(pGlobalOperations);
@@ -105,6 +108,13 @@ void SysmanDeviceImp::init() {
     if (pFirmwareHandleContext) {
         pFirmwareHandleContext->init();
     }
+
+    pTelemetrySampler = TelemetrySampler::create();
+    if (pTelemetrySampler) {
+        pPowerHandleContext->enableTelemetrySampling(*pTelemetrySampler);
+        pEngineHandleContext->enableTelemetrySampling(*pTelemetrySampler);
+        pTelemetrySampler->start();
+    }
 }
 
 ze_result_t SysmanDeviceImp::frequencyGet(uint32_t *pCount, zes_freq_handle_t *phFrequency) {
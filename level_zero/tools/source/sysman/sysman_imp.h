@@ -15,6 +15,7 @@
 #include <unordered_map>
 
 namespace L0 {
+class TelemetrySampler;
 
 struct SysmanDeviceImp : SysmanDevice, NEO::NonCopyableOrMovableClass {
 
@@ -39,6 +40,7 @@ struct SysmanDeviceImp : SysmanDevice, NEO::NonCopyableOrMovableClass {
     MemoryHandleContext *pMemoryHandleContext = nullptr;
     FanHandleContext *pFanHandleContext = nullptr;
     FirmwareHandleContext *pFirmwareHandleContext = nullptr;
+    TelemetrySampler *pTelemetrySampler = nullptr;
 
     ze_result_t powerGet(uint32_t *pCount, zes_pwr_handle_t *phPower) override;
     ze_result_t frequencyGet(uint32_t *pCount, zes_freq_handle_t *phFrequency) override;
@@ -0,0 +1,161 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "level_zero/tools/source/sysman/telemetry_sampler.h"
+
+#include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/helpers/debug_helpers.h"
+
+#include <algorithm>
+#include <chrono>
+
+namespace L0 {
+
+void TelemetryRingBuffer::push(const TelemetrySample &sample) {
+    auto index = pushedCount.load(std::memory_order_relaxed);
+    auto &slot = slots[index % capacity];
+    slot.sequence.store(2 * index + 1, std::memory_order_relaxed);
+    // Reader that observes any of new values also observes odd sequence
+    slot.value.store(sample.value, std::memory_order_release);
+    slot.timestamp.store(sample.timestamp, std::memory_order_release);
+    slot.sequence.store(2 * (index + 1), std::memory_order_release);
+    pushedCount.store(index + 1, std::memory_order_release);
+}
+
+bool TelemetryRingBuffer::read(uint64_t index, TelemetrySample &sample) const {
+    auto &slot = slots[index % capacity];
+    auto sequence = 2 * (index + 1);
+    if (slot.sequence.load(std::memory_order_acquire) != sequence) {
+        return false;
+    }
+    sample.value = slot.value.load(std::memory_order_acquire);
+    sample.timestamp = slot.timestamp.load(std::memory_order_acquire);
+    // Sample is torn when the writer wrapped around to this slot meanwhile
+    return slot.sequence.load(std::memory_order_relaxed) == sequence;
+}
+
+bool TelemetryRingBuffer::getLatest(TelemetrySample &sample) const {
+    auto count = getPushedCount();
+    if (count == 0) {
+        return false;
+    }
+    return read(count - 1, sample);
+}
+
+uint32_t TelemetryRingBuffer::getHistory(uint32_t count, std::vector<TelemetrySample> &samples) const {
+    auto pushed = getPushedCount();
+    auto available = std::min(pushed, static_cast<uint64_t>(std::min(count, static_cast<uint32_t>(capacity))));
+    uint32_t retrieved = 0;
+    for (auto index = pushed - available; index < pushed; index++) {
+        TelemetrySample sample;
+        if (read(index, sample)) {
+            samples.push_back(sample);
+            retrieved++;
+        }
+    }
+    return retrieved;
+}
+
+TelemetrySampler *TelemetrySampler::create() {
+    auto periodMs = NEO::DebugManager.flags.SysmanTelemetrySamplingPeriod.get();
+    if (periodMs <= 0) {
+        return nullptr;
+    }
+    return new TelemetrySampler(static_cast<uint32_t>(periodMs));
+}
+
+TelemetrySampler::~TelemetrySampler() {
+    stop();
+}
+
+uint32_t TelemetrySampler::addMetrics(uint32_t count, ReadFunction readFunction) {
+    // Metrics are not guarded against the sampler thread
+    UNRECOVERABLE_IF(isRunning());
+    auto firstMetric = getMetricsCount();
+    for (uint32_t i = 0; i < count; i++) {
+        buffers.push_back(std::make_unique<TelemetryRingBuffer>());
+    }
+    sources.push_back({std::move(readFunction), firstMetric, count});
+    return firstMetric;
+}
+
+void TelemetrySampler::start() {
+    if (isRunning() || sources.empty()) {
+        return;
+    }
+    stopRequested = false;
+    thread = NEO::Thread::create(worker, reinterpret_cast<void *>(this));
+    running.store(true, std::memory_order_release);
+}
+
+void TelemetrySampler::stop() {
+    if (!isRunning()) {
+        return;
+    }
+    running.store(false, std::memory_order_release);
+    std::unique_lock<std::mutex> lock(stopMutex);
+    stopRequested = true;
+    lock.unlock();
+    stopCondition.notify_one();
+    thread->join();
+    thread.reset();
+
+    PRINT_DEBUG_STRING(NEO::DebugManager.flags.PrintDebugMessages.get(), stderr,
+                       "Sysman telemetry sampler: %llu sampling rounds took %llu ns\n",
+                       static_cast<unsigned long long>(getSamplingRoundsCount()),
+                       static_cast<unsigned long long>(getSamplingTimeNs()));
+}
+
+void TelemetrySampler::sample() {
+    auto begin = std::chrono::steady_clock::now();
+    for (auto &source : sources) {
+        sourceSamples.assign(source.count, TelemetrySample{});
+        if (ZE_RESULT_SUCCESS != source.read(sourceSamples)) {
+            continue;
+        }
+        for (uint32_t i = 0; i < source.count; i++) {
+            buffers[source.firstMetric + i]->push(sourceSamples[i]);
+        }
+    }
+    auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - begin);
+    samplingTimeNs.fetch_add(static_cast<uint64_t>(elapsed.count()), std::memory_order_relaxed);
+    samplingRoundsCount.fetch_add(1, std::memory_order_release);
+}
+
+bool TelemetrySampler::getLatestSample(uint32_t metric, TelemetrySample &sample) const {
+    if (metric >= getMetricsCount()) {
+        return false;
+    }
+    return buffers[metric]->getLatest(sample);
+}
+
+uint32_t TelemetrySampler::getSampleHistory(uint32_t metric, uint32_t count, std::vector<TelemetrySample> &samples) const {
+    if (metric >= getMetricsCount()) {
+        return 0;
+    }
+    return buffers[metric]->getHistory(count, samples);
+}
+
+void *TelemetrySampler::worker(void *arg) {
+    auto sampler = reinterpret_cast<TelemetrySampler *>(arg);
+    std::chrono::steady_clock::duration period = std::chrono::milliseconds(sampler->periodMs);
+    auto nextRound = std::chrono::steady_clock::now();
+
+    std::unique_lock<std::mutex> lock(sampler->stopMutex);
+    while (!sampler->stopRequested) {
+        lock.unlock();
+        sampler->sample();
+        lock.lock();
+
+        // Keep fixed sampling rate, without catching up on rounds missed when sampling took longer than period
+        nextRound = std::max(nextRound + period, std::chrono::steady_clock::now());
+        sampler->stopCondition.wait_until(lock, nextRound, [sampler] { return sampler->stopRequested; });
+    }
+    return nullptr;
+}
+
+} // namespace L0
@@ -0,0 +1,105 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/helpers/non_copyable_or_moveable.h"
+#include "shared/source/os_interface/os_thread.h"
+
+#include <level_zero/ze_api.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace L0 {
+
+struct TelemetrySample {
+    uint64_t value = 0;
+    uint64_t timestamp = 0;
+};
+
+// Written only by the sampler thread, read by API threads without locking.
+// Slot sequence is odd while the slot is being written and 2 * (index + 1) once sample index is stored in it.
+class TelemetryRingBuffer : NEO::NonCopyableOrMovableClass {
+  public:
+    static constexpr uint32_t capacity = 256u;
+    static_assert((capacity & (capacity - 1)) == 0, "capacity must be power of 2");
+
+    TelemetryRingBuffer() = default;
+
+    void push(const TelemetrySample &sample);
+    bool getLatest(TelemetrySample &sample) const;
+    uint32_t getHistory(uint32_t count, std::vector<TelemetrySample> &samples) const;
+    uint64_t getPushedCount() const { return pushedCount.load(std::memory_order_acquire); }
+
+  protected:
+    struct Slot {
+        std::atomic<uint64_t> sequence{0};
+        std::atomic<uint64_t> value{0};
+        std::atomic<uint64_t> timestamp{0};
+    };
+
+    bool read(uint64_t index, TelemetrySample &sample) const;
+
+    Slot slots[capacity];
+    std::atomic<uint64_t> pushedCount{0};
+};
+
+class TelemetrySampler : NEO::NonCopyableOrMovableClass {
+  public:
+    // Fills one sample per metric of the source, samples are dropped when the read fails
+    using ReadFunction = std::function<ze_result_t(std::vector<TelemetrySample> &samples)>;
+
+    static TelemetrySampler *create();
+
+    TelemetrySampler(uint32_t periodMs) : periodMs(periodMs) {}
+    ~TelemetrySampler();
+
+    uint32_t addMetrics(uint32_t count, ReadFunction readFunction);
+    void start();
+    void stop();
+    void sample();
+
+    bool getLatestSample(uint32_t metric, TelemetrySample &sample) const;
+    uint32_t getSampleHistory(uint32_t metric, uint32_t count, std::vector<TelemetrySample> &samples) const;
+
+    uint32_t getPeriod() const { return periodMs; }
+    uint32_t getMetricsCount() const { return static_cast<uint32_t>(buffers.size()); }
+    bool isRunning() const { return running.load(std::memory_order_acquire); }
+    // Overhead of sampling itself, as number of sampling rounds and time they took
+    uint64_t getSamplingRoundsCount() const { return samplingRoundsCount.load(std::memory_order_acquire); }
+    uint64_t getSamplingTimeNs() const { return samplingTimeNs.load(std::memory_order_relaxed); }
+
+  protected:
+    struct MetricSource {
+        ReadFunction read;
+        uint32_t firstMetric;
+        uint32_t count;
+    };
+
+    static void *worker(void *arg);
+
+    uint32_t periodMs;
+    std::vector<MetricSource> sources;
+    std::vector<std::unique_ptr<TelemetryRingBuffer>> buffers;
+    std::vector<TelemetrySample> sourceSamples;
+
+    std::unique_ptr<NEO::Thread> thread;
+    std::mutex stopMutex;
+    std::condition_variable stopCondition;
+    bool stopRequested = false;
+    std::atomic<bool> running{false};
+
+    std::atomic<uint64_t> samplingRoundsCount{0};
+    std::atomic<uint64_t> samplingTimeNs{0};
+};
+
+} // namespace L0
@@ -75,9 +75,29 @@ struct Mock<MockPmuInterfaceImp> : public MockPmuInterfaceImp {
     int64_t mockedPerfEventOpenAndFailureReturn(perf_event_attr *attr, pid_t pid, int cpu, int groupFd, uint64_t flags) {
         return -1;
     }
+    int64_t mockedPerfEventOpenAndGroupFailureReturn(perf_event_attr *attr, pid_t pid, int cpu, int groupFd, uint64_t flags) {
+        if (groupFd >= 0 || (attr->read_format & PERF_FORMAT_GROUP)) {
+            return -1;
+        }
+        return mockPmuFd;
+    }
     int mockedPmuReadSingleAndSuccessReturn(int fd, uint64_t *data, ssize_t sizeOfdata) {
-        data[0] = mockActiveTime;
+        auto count = static_cast<size_t>(sizeOfdata) / sizeof(uint64_t);
+        if (count == 2) {
+            data[0] = mockActiveTime;
+            data[1] = mockTimestamp;
+            return 0;
+        }
+        // Group read format: number of events, time enabled, then value of each event
+        data[0] = count - 2;
         data[1] = mockTimestamp;
+        for (size_t i = 2; i < count; i++) {
+            data[i] = mockActiveTime;
+        }
+        return 0;
+    }
+    int mockedPmuReadSingleWithInvalidEventsCountReturn(int fd, uint64_t *data, ssize_t sizeOfdata) {
+        data[0] = 0;
         return 0;
     }
     int mockedPmuReadSingleAndFailureReturn(int fd, uint64_t *data, ssize_t sizeOfdata) {
@@ -5,6 +5,7 @@
  *
  */
 
+#include "level_zero/tools/source/sysman/telemetry_sampler.h"
 #include "level_zero/tools/test/unit_tests/sources/sysman/linux/mock_sysman_fixture.h"
 
 #include "mock_engine.h"
@@ -207,5 +208,66 @@ TEST_F(ZesEngineFixture, GivenValidOsSysmanPointerWhenRetrievingEngineTypeAndIns
     EXPECT_EQ(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, OsEngine::getNumEngineTypeAndInstances(engineGroupInstance, pOsSysman));
 }
 
+TEST_F(ZesEngineFixture, GivenValidEngineHandlesWhenGettingActivitySnapshotThenAllEnginesAreReadWithSingleReadAndShareTimestamp) {
+    EXPECT_CALL(*pPmuInterface.get(), pmuReadSingle(_, _, _))
+        .Times(1)
+        .WillOnce(::testing::Invoke(pPmuInterface.get(), &Mock<MockPmuInterfaceImp>::mockedPmuReadSingleAndSuccessReturn));
+
+    std::vector<zes_engine_stats_t> stats;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, pSysmanDeviceImp->pEngineHandleContext->engineGetActivitySnapshot(stats));
+    EXPECT_EQ(handleComponentCount, stats.size());
+    for (auto &engineStats : stats) {
+        EXPECT_EQ(mockActiveTime / microSecondsToNanoSeconds, engineStats.activeTime);
+        EXPECT_EQ(stats[0].timestamp, engineStats.timestamp);
+    }
+}
+
+TEST_F(ZesEngineFixture, GivenTelemetrySamplingEnabledWhenSamplingThenActivityOfAllEnginesIsSampledWithSingleRead) {
+    TelemetrySampler sampler(1u);
+    pSysmanDeviceImp->pEngineHandleContext->enableTelemetrySampling(sampler);
+    EXPECT_EQ(handleComponentCount, sampler.getMetricsCount());
+
+    EXPECT_CALL(*pPmuInterface.get(), pmuReadSingle(_, _, _))
+        .Times(1)
+        .WillOnce(::testing::Invoke(pPmuInterface.get(), &Mock<MockPmuInterfaceImp>::mockedPmuReadSingleAndSuccessReturn));
+    sampler.sample();
+
+    for (uint32_t metric = 0; metric < handleComponentCount; metric++) {
+        TelemetrySample sample;
+        EXPECT_TRUE(sampler.getLatestSample(metric, sample));
+        EXPECT_EQ(mockActiveTime / microSecondsToNanoSeconds, sample.value);
+        EXPECT_EQ(mockTimestamp / microSecondsToNanoSeconds, sample.timestamp);
+    }
+}
+
+TEST_F(ZesEngineFixture, GivenGroupReadReturnsUnexpectedEventsCountWhenGettingActivityThenFailureIsReturned) {
+    ON_CALL(*pPmuInterface.get(), pmuReadSingle(_, _, _))
+        .WillByDefault(::testing::Invoke(pPmuInterface.get(), &Mock<MockPmuInterfaceImp>::mockedPmuReadSingleWithInvalidEventsCountReturn));
+
+    zes_engine_stats_t stats = {};
+    auto handles = getEngineHandles(handleComponentCount);
+    EXPECT_EQ(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, zesEngineGetActivity(handles[0], &stats));
+
+    std::vector<zes_engine_stats_t> snapshot;
+    EXPECT_EQ(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, pSysmanDeviceImp->pEngineHandleContext->engineGetActivitySnapshot(snapshot));
+}
+
+TEST_F(ZesEngineFixture, GivenEngineCannotBeOpenedInEventGroupWhenGettingActivityThenEngineIsReadOnItsOwn) {
+    pSysmanDeviceImp->pEngineHandleContext->releaseEngines();
+    ON_CALL(*pPmuInterface.get(), perfEventOpen(_, _, _, _, _))
+        .WillByDefault(::testing::Invoke(pPmuInterface.get(), &Mock<MockPmuInterfaceImp>::mockedPerfEventOpenAndGroupFailureReturn));
+
+    auto pOsEngine = OsEngine::create(pOsSysman, ZES_ENGINE_GROUP_RENDER_SINGLE, 0u);
+
+    EXPECT_CALL(*pPmuInterface.get(), pmuReadSingle(_, _, static_cast<ssize_t>(2 * sizeof(uint64_t))))
+        .Times(1)
+        .WillOnce(::testing::Invoke(pPmuInterface.get(), &Mock<MockPmuInterfaceImp>::mockedPmuReadSingleAndSuccessReturn));
+    zes_engine_stats_t stats = {};
+    EXPECT_EQ(ZE_RESULT_SUCCESS, pOsEngine->getActivity(&stats));
+    EXPECT_EQ(mockActiveTime / microSecondsToNanoSeconds, stats.activeTime);
+    EXPECT_EQ(mockTimestamp / microSecondsToNanoSeconds, stats.timestamp);
+    delete pOsEngine;
+}
+
 } // namespace ult
-} // namespace L0
\ No newline at end of file
+} // namespace L0
@@ -137,6 +137,23 @@ struct Mock<GlobalOperationsSysfsAccess> : public GlobalOperationsSysfsAccess {
         return ZE_RESULT_SUCCESS;
     }
 
+    ze_result_t getValUnsignedLongWithClient3PidChanged(const std::string file, uint64_t &val) {
+        if (file.compare("clients/6/pid") == 0) {
+            val = pid3;
+            return ZE_RESULT_SUCCESS;
+        }
+        return getValUnsignedLong(file, val);
+    }
+
+    ze_result_t getScannedDirEntriesWithoutClient3(const std::string path, std::vector<std::string> &list) {
+        if (path.compare(clientsDir) == 0) {
+            list.push_back(clientId1);
+            list.push_back(clientId2);
+            return ZE_RESULT_SUCCESS;
+        }
+        return getScannedDirEntries(path, list);
+    }
+
     Mock<GlobalOperationsSysfsAccess>() = default;
 
     MOCK_METHOD(ze_result_t, read, (const std::string file, std::string &val), (override));
@@ -9,6 +9,7 @@
 
 #include "mock_global_operations.h"
 
+using ::testing::AnyNumber;
 using ::testing::Matcher;
 
 namespace L0 {
@@ -152,6 +153,76 @@ TEST_F(SysmanGlobalOperationsFixture, GivenValidDeviceHandleWhileRetrievingInfor
     EXPECT_EQ(processes[1].sharedSize, sharedMemSize2);
 }
 
+TEST_F(SysmanGlobalOperationsFixture, GivenProcessesAlreadyScannedWhenRetrievingInformationAboutHostProcessesAgainThenBusyFilesOfEnginesAlreadyUsedAreNotRead) {
+    uint32_t count = 0;
+    ASSERT_EQ(ZE_RESULT_SUCCESS, zesDeviceProcessesGetState(device, &count, nullptr));
+    EXPECT_EQ(count, totalProcessStates);
+
+    EXPECT_CALL(*pSysfsAccess.get(), read(_, Matcher<uint64_t &>(_)))
+        .Times(AnyNumber());
+    EXPECT_CALL(*pSysfsAccess.get(), read(std::string("clients/4/busy/0"), Matcher<uint64_t &>(_)))
+        .Times(0);
+    EXPECT_CALL(*pSysfsAccess.get(), read(std::string("clients/4/busy/3"), Matcher<uint64_t &>(_)))
+        .Times(0);
+    EXPECT_CALL(*pSysfsAccess.get(), read(std::string("clients/4/busy/1"), Matcher<uint64_t &>(_)))
+        .Times(1);
+    EXPECT_CALL(*pSysfsAccess.get(), scanDirEntries(_, _))
+        .Times(AnyNumber());
+    EXPECT_CALL(*pSysfsAccess.get(), scanDirEntries(std::string("clients/4/busy"), _))
+        .Times(0);
+
+    std::vector<zes_process_state_t> processes(count);
+    ASSERT_EQ(ZE_RESULT_SUCCESS, zesDeviceProcessesGetState(device, &count, processes.data()));
+    EXPECT_EQ(processes[0].processId, pid1);
+    EXPECT_EQ(processes[0].engines, engines1);
+    EXPECT_EQ(processes[0].memSize, memSize1);
+    EXPECT_EQ(processes[0].sharedSize, sharedMemSize1);
+    EXPECT_EQ(processes[1].processId, pid2);
+    EXPECT_EQ(processes[1].engines, engines2);
+    EXPECT_EQ(processes[1].memSize, memSize2);
+    EXPECT_EQ(processes[1].sharedSize, sharedMemSize2);
+}
+
+TEST_F(SysmanGlobalOperationsFixture, GivenProcessesAlreadyScannedWhenClientIsClosedThenProcessOfThatClientIsNotReported) {
+    uint32_t count = 0;
+    ASSERT_EQ(ZE_RESULT_SUCCESS, zesDeviceProcessesGetState(device, &count, nullptr));
+    EXPECT_EQ(count, totalProcessStates);
+
+    ON_CALL(*pSysfsAccess.get(), scanDirEntries(_, _))
+        .WillByDefault(::testing::Invoke(pSysfsAccess.get(), &Mock<GlobalOperationsSysfsAccess>::getScannedDirEntriesWithoutClient3));
+    count = 0;
+    ASSERT_EQ(ZE_RESULT_SUCCESS, zesDeviceProcessesGetState(device, &count, nullptr));
+    EXPECT_EQ(count, 1u);
+    std::vector<zes_process_state_t> processes(count);
+    ASSERT_EQ(ZE_RESULT_SUCCESS, zesDeviceProcessesGetState(device, &count, processes.data()));
+    EXPECT_EQ(processes[0].processId, pid1);
+    EXPECT_EQ(processes[0].engines, engines1);
+    EXPECT_EQ(processes[0].memSize, memSize1);
+    EXPECT_EQ(processes[0].sharedSize, sharedMemSize1);
+}
+
+TEST_F(SysmanGlobalOperationsFixture, GivenProcessesAlreadyScannedWhenClientIdIsUsedByAnotherProcessThenBusyDirectoryOfThatClientIsScannedAgain) {
+    uint32_t count = 0;
+    ASSERT_EQ(ZE_RESULT_SUCCESS, zesDeviceProcessesGetState(device, &count, nullptr));
+    EXPECT_EQ(count, totalProcessStates);
+
+    ON_CALL(*pSysfsAccess.get(), read(_, Matcher<uint64_t &>(_)))
+        .WillByDefault(::testing::Invoke(pSysfsAccess.get(), &Mock<GlobalOperationsSysfsAccess>::getValUnsignedLongWithClient3PidChanged));
+    EXPECT_CALL(*pSysfsAccess.get(), scanDirEntries(_, _))
+        .Times(AnyNumber());
+    EXPECT_CALL(*pSysfsAccess.get(), scanDirEntries(std::string("clients/6/busy"), _))
+        .Times(1);
+
+    std::vector<zes_process_state_t> processes(count);
+    ASSERT_EQ(ZE_RESULT_SUCCESS, zesDeviceProcessesGetState(device, &count, processes.data()));
+    EXPECT_EQ(processes[0].processId, pid1);
+    EXPECT_EQ(processes[0].engines, engines1);
+    EXPECT_EQ(processes[1].processId, pid3);
+    EXPECT_EQ(processes[1].engines, engines2);
+    EXPECT_EQ(processes[1].memSize, memSize2);
+    EXPECT_EQ(processes[1].sharedSize, sharedMemSize2);
+}
+
 TEST_F(SysmanGlobalOperationsFixture, GivenValidDeviceHandleWhileRetrievingInformationAboutHostProcessesUsingFaultyClientFileThenFailureIsReturned) {
     uint32_t count = 0;
     ON_CALL(*pSysfsAccess.get(), scanDirEntries(_, _))
@@ -9,9 +9,111 @@
 
 #include "level_zero/tools/test/unit_tests/sources/sysman/linux/mock_sysman_fixture.h"
 
+#include <cstdio>
+#include <fstream>
+
 namespace L0 {
 namespace ult {
 
+struct PublicFsAccess : public FsAccess {
+    using FsAccess::fileDescriptorCache;
+};
+
+class FsAccessFakeSysfsTest : public ::testing::Test {
+  public:
+    void SetUp() override {
+        char dirTemplate[] = "/tmp/fake_sysfs_XXXXXX";
+        ASSERT_NE(nullptr, ::mkdtemp(dirTemplate));
+        dirName = dirTemplate;
+    }
+
+    void TearDown() override {
+        for (auto &file : createdFiles) {
+            std::remove(file.c_str());
+        }
+        ::rmdir(dirName.c_str());
+    }
+
+    std::string writeFile(const std::string &name, const std::string &contents) {
+        std::string file = dirName + "/" + name;
+        std::ofstream fs(file, std::ofstream::trunc);
+        fs << contents;
+        createdFiles.push_back(file);
+        return file;
+    }
+
+    std::string dirName;
+    std::vector<std::string> createdFiles;
+    PublicFsAccess fsAccess;
+};
+
+TEST_F(FsAccessFakeSysfsTest, GivenNumericFileWhenReadRepeatedlyThenFileIsKeptOpenAndLatestValueIsReturned) {
+    auto file = writeFile("energy_uj", "12345\n");
+
+    uint64_t val = 0;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, fsAccess.read(file, val));
+    EXPECT_EQ(12345u, val);
+    EXPECT_EQ(1u, fsAccess.fileDescriptorCache.getCachedFileDescriptorsCount());
+
+    writeFile("energy_uj", "67890\n");
+    EXPECT_EQ(ZE_RESULT_SUCCESS, fsAccess.read(file, val));
+    EXPECT_EQ(67890u, val);
+    EXPECT_EQ(1u, fsAccess.fileDescriptorCache.getCachedFileDescriptorsCount());
+}
+
+TEST_F(FsAccessFakeSysfsTest, GivenNumericFilesWhenReadAsDifferentTypesThenValuesAreParsed) {
+    uint32_t uint32Val = 0;
+    int32_t int32Val = 0;
+    double doubleVal = 0.0;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, fsAccess.read(writeFile("freq", "1100\n"), uint32Val));
+    EXPECT_EQ(1100u, uint32Val);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, fsAccess.read(writeFile("temp", "-40\n"), int32Val));
+    EXPECT_EQ(-40, int32Val);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, fsAccess.read(writeFile("ratio", "0.5\n"), doubleVal));
+    EXPECT_DOUBLE_EQ(0.5, doubleVal);
+}
+
+TEST_F(FsAccessFakeSysfsTest, GivenFileWithInvalidContentsWhenReadingNumericValueThenErrorIsReturned) {
+    uint32_t uint32Val = 0;
+    uint64_t uint64Val = 0;
+    EXPECT_EQ(ZE_RESULT_ERROR_UNKNOWN, fsAccess.read(writeFile("empty", ""), uint64Val));
+    EXPECT_EQ(ZE_RESULT_ERROR_UNKNOWN, fsAccess.read(writeFile("text", "enabled\n"), uint64Val));
+    EXPECT_EQ(ZE_RESULT_ERROR_UNKNOWN, fsAccess.read(writeFile("large", "4294967296\n"), uint32Val));
+}
+
+TEST_F(FsAccessFakeSysfsTest, GivenMissingFileWhenReadingNumericValueThenNotAvailableIsReturnedAndNothingIsCached) {
+    uint64_t val = 0;
+    EXPECT_EQ(ZE_RESULT_ERROR_NOT_AVAILABLE, fsAccess.read(dirName + "/noSuchFile", val));
+    EXPECT_EQ(0u, fsAccess.fileDescriptorCache.getCachedFileDescriptorsCount());
+}
+
+TEST_F(FsAccessFakeSysfsTest, GivenCachedFileWhenFileIsRecreatedAndCacheInvalidatedThenNewFileIsRead) {
+    auto file = writeFile("power1_max", "100\n");
+    uint64_t val = 0;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, fsAccess.read(file, val));
+    EXPECT_EQ(100u, val);
+
+    std::remove(file.c_str());
+    writeFile("power1_max", "200\n");
+    fsAccess.invalidateCachedFiles();
+    EXPECT_EQ(0u, fsAccess.fileDescriptorCache.getCachedFileDescriptorsCount());
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, fsAccess.read(file, val));
+    EXPECT_EQ(200u, val);
+}
+
+TEST_F(FsAccessFakeSysfsTest, GivenCacheIsFullWhenReadingAnotherFileThenValueIsReadWithoutCachingIt) {
+    uint64_t val = 0;
+    for (size_t i = 0; i < FileDescriptorCache::maxCachedFileDescriptors; i++) {
+        EXPECT_EQ(ZE_RESULT_SUCCESS, fsAccess.read(writeFile("file" + std::to_string(i), std::to_string(i)), val));
+    }
+    auto cachedCount = fsAccess.fileDescriptorCache.getCachedFileDescriptorsCount();
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, fsAccess.read(writeFile("oneMore", "7"), val));
+    EXPECT_EQ(7u, val);
+    EXPECT_EQ(cachedCount, fsAccess.fileDescriptorCache.getCachedFileDescriptorsCount());
+}
+
 using MockDeviceSysmanGetTest = Test<DeviceFixture>;
 TEST_F(MockDeviceSysmanGetTest, GivenValidSysmanHandleSetInDeviceStructWhenGetThisSysmanHandleThenHandlesShouldBeSimilar) {
     SysmanDeviceImp *sysman = new SysmanDeviceImp(device->toHandle());
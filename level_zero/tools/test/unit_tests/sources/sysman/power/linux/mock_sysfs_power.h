@@ -34,11 +34,15 @@ struct Mock<PowerPmt> : public PlatformMonitoringTech {
 
     void init(const std::string &deviceName, FsAccess *pFsAccess) override {
         mappedMemory = new char[mappedLength];
-        // fill memmory with 8 bytes of data using setEnergyCoutner at offset = 0x400
+        setEnergyCounterValue(setEnergyCounter);
+        pmtSupported = true;
+    }
+
+    void setEnergyCounterValue(uint64_t energyCounter) {
+        // fill memmory with 8 bytes of data using energyCounter at offset = 0x400
         for (uint64_t i = 0; i < sizeof(uint64_t); i++) {
-            mappedMemory[offset + i] = static_cast<char>((setEnergyCounter >> 8 * i) & 0xff);
+            mappedMemory[offset + i] = static_cast<char>((energyCounter >> 8 * i) & 0xff);
         }
-        pmtSupported = true;
     }
 };
 
@@ -12,6 +12,9 @@
 #include "gtest/gtest.h"
 #include "mock_sysfs_power.h"
 #include "sysman/power/power_imp.h"
+#include "sysman/telemetry_sampler.h"
+
+#include <thread>
 
 namespace L0 {
 namespace ult {
@@ -92,6 +95,30 @@ TEST_F(SysmanDevicePowerFixture, GivenValidPowerHandleWhenGettingPowerEnergyCoun
     }
 }
 
+TEST_F(SysmanDevicePowerFixture, GivenTelemetrySamplingEnabledWhenGettingPowerEnergyCounterThenLatestSampleIsReturnedWhileSamplerIsRunning) {
+    auto handles = get_power_handles(powerHandleComponentCount);
+    auto pPowerImp = static_cast<PowerImp *>(Power::fromHandle(handles[0]));
+    uint64_t sampledEnergyCounter = convertJouleToMicroJoule * setEnergyCounter;
+    uint64_t currentEnergyCounter = convertJouleToMicroJoule * (setEnergyCounter + 1);
+
+    // Long period, so that only first round samples the counter before sampler is stopped
+    auto sampler = std::make_unique<TelemetrySampler>(60000u);
+    pPowerImp->enableTelemetrySampling(*sampler);
+    sampler->start();
+    while (sampler->getSamplingRoundsCount() == 0) {
+        std::this_thread::yield();
+    }
+    pPmt->setEnergyCounterValue(setEnergyCounter + 1);
+
+    zes_power_energy_counter_t energyCounter;
+    ASSERT_EQ(ZE_RESULT_SUCCESS, zesPowerGetEnergyCounter(handles[0], &energyCounter));
+    EXPECT_EQ(energyCounter.energy, sampledEnergyCounter);
+
+    sampler->stop();
+    ASSERT_EQ(ZE_RESULT_SUCCESS, zesPowerGetEnergyCounter(handles[0], &energyCounter));
+    EXPECT_EQ(energyCounter.energy, currentEnergyCounter);
+}
+
 TEST_F(SysmanDevicePowerFixture, GivenValidPowerHandleWhenGettingPowerEnergyThresholdThenUnsupportedFeatureErrorIsReturned) {
     zes_energy_threshold_t threshold;
     auto handles = get_power_handles(powerHandleComponentCount);
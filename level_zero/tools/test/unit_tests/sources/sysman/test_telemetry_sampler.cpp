@@ -0,0 +1,165 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/test/unit_test/helpers/debug_manager_state_restore.h"
+
+#include "test.h"
+
+#include "level_zero/tools/source/sysman/telemetry_sampler.h"
+
+#include <memory>
+#include <thread>
+
+namespace L0 {
+namespace ult {
+
+TEST(TelemetryRingBufferTest, GivenNoSamplesPushedWhenGettingLatestSampleThenFalseIsReturned) {
+    TelemetryRingBuffer ringBuffer;
+    TelemetrySample sample;
+    EXPECT_FALSE(ringBuffer.getLatest(sample));
+    EXPECT_EQ(0u, ringBuffer.getPushedCount());
+
+    std::vector<TelemetrySample> samples;
+    EXPECT_EQ(0u, ringBuffer.getHistory(4u, samples));
+    EXPECT_TRUE(samples.empty());
+}
+
+TEST(TelemetryRingBufferTest, GivenSamplesPushedWhenGettingHistoryThenMostRecentSamplesAreReturnedOldestFirst) {
+    TelemetryRingBuffer ringBuffer;
+    for (uint64_t i = 1; i <= 3; i++) {
+        ringBuffer.push({i * 10, i});
+    }
+
+    TelemetrySample sample;
+    EXPECT_TRUE(ringBuffer.getLatest(sample));
+    EXPECT_EQ(30u, sample.value);
+    EXPECT_EQ(3u, sample.timestamp);
+
+    std::vector<TelemetrySample> samples;
+    EXPECT_EQ(2u, ringBuffer.getHistory(2u, samples));
+    ASSERT_EQ(2u, samples.size());
+    EXPECT_EQ(20u, samples[0].value);
+    EXPECT_EQ(30u, samples[1].value);
+}
+
+TEST(TelemetryRingBufferTest, GivenMoreSamplesPushedThanCapacityWhenGettingHistoryThenOnlyLastCapacitySamplesAreReturned) {
+    TelemetryRingBuffer ringBuffer;
+    uint64_t pushedCount = TelemetryRingBuffer::capacity + 10;
+    for (uint64_t i = 0; i < pushedCount; i++) {
+        ringBuffer.push({i, i});
+    }
+    EXPECT_EQ(pushedCount, ringBuffer.getPushedCount());
+
+    std::vector<TelemetrySample> samples;
+    EXPECT_EQ(static_cast<uint32_t>(TelemetryRingBuffer::capacity), ringBuffer.getHistory(2 * TelemetryRingBuffer::capacity, samples));
+    EXPECT_EQ(10u, samples.front().value);
+    EXPECT_EQ(pushedCount - 1, samples.back().value);
+
+    TelemetrySample sample;
+    EXPECT_TRUE(ringBuffer.getLatest(sample));
+    EXPECT_EQ(pushedCount - 1, sample.value);
+}
+
+TEST(TelemetrySamplerTest, GivenDefaultSettingsWhenCreatingSamplerThenSamplingIsDisabled) {
+    std::unique_ptr<TelemetrySampler> sampler(TelemetrySampler::create());
+    EXPECT_EQ(nullptr, sampler.get());
+}
+
+TEST(TelemetrySamplerTest, GivenSamplingPeriodSetWhenCreatingSamplerThenSamplerWithThatPeriodIsCreated) {
+    DebugManagerStateRestore restore;
+    NEO::DebugManager.flags.SysmanTelemetrySamplingPeriod.set(5);
+
+    std::unique_ptr<TelemetrySampler> sampler(TelemetrySampler::create());
+    ASSERT_NE(nullptr, sampler.get());
+    EXPECT_EQ(5u, sampler->getPeriod());
+    EXPECT_FALSE(sampler->isRunning());
+}
+
+TEST(TelemetrySamplerTest, GivenMetricsAddedWhenSamplingThenEachMetricGetsSampleOfItsSource) {
+    TelemetrySampler sampler(1u);
+    uint64_t value = 100;
+    auto firstMetric = sampler.addMetrics(2u, [&value](std::vector<TelemetrySample> &samples) {
+        samples[0] = {value, 1};
+        samples[1] = {value + 1, 1};
+        return ZE_RESULT_SUCCESS;
+    });
+    auto secondMetric = sampler.addMetrics(1u, [&value](std::vector<TelemetrySample> &samples) {
+        samples[0] = {value + 2, 2};
+        return ZE_RESULT_SUCCESS;
+    });
+    EXPECT_EQ(0u, firstMetric);
+    EXPECT_EQ(2u, secondMetric);
+    EXPECT_EQ(3u, sampler.getMetricsCount());
+
+    sampler.sample();
+    value = 200;
+    sampler.sample();
+
+    TelemetrySample sample;
+    EXPECT_TRUE(sampler.getLatestSample(firstMetric, sample));
+    EXPECT_EQ(200u, sample.value);
+    EXPECT_TRUE(sampler.getLatestSample(firstMetric + 1, sample));
+    EXPECT_EQ(201u, sample.value);
+    EXPECT_TRUE(sampler.getLatestSample(secondMetric, sample));
+    EXPECT_EQ(202u, sample.value);
+    EXPECT_EQ(2u, sample.timestamp);
+    EXPECT_FALSE(sampler.getLatestSample(3u, sample));
+
+    std::vector<TelemetrySample> samples;
+    EXPECT_EQ(2u, sampler.getSampleHistory(secondMetric, 8u, samples));
+    EXPECT_EQ(102u, samples[0].value);
+    EXPECT_EQ(202u, samples[1].value);
+    EXPECT_EQ(0u, sampler.getSampleHistory(3u, 8u, samples));
+
+    EXPECT_EQ(2u, sampler.getSamplingRoundsCount());
+}
+
+TEST(TelemetrySamplerTest, GivenSourceReadFailsWhenSamplingThenNoSampleIsStored) {
+    TelemetrySampler sampler(1u);
+    auto metric = sampler.addMetrics(1u, [](std::vector<TelemetrySample> &samples) {
+        samples[0] = {1, 1};
+        return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    });
+
+    sampler.sample();
+
+    TelemetrySample sample;
+    EXPECT_FALSE(sampler.getLatestSample(metric, sample));
+    EXPECT_EQ(1u, sampler.getSamplingRoundsCount());
+}
+
+TEST(TelemetrySamplerTest, GivenNoMetricsWhenStartingSamplerThenThreadIsNotStarted) {
+    TelemetrySampler sampler(1u);
+    sampler.start();
+    EXPECT_FALSE(sampler.isRunning());
+}
+
+TEST(TelemetrySamplerTest, GivenSamplerStartedThenMetricsAreSampledInBackgroundUntilSamplerIsStopped) {
+    TelemetrySampler sampler(1u);
+    std::atomic<uint64_t> value{0};
+    auto metric = sampler.addMetrics(1u, [&value](std::vector<TelemetrySample> &samples) {
+        samples[0] = {++value, 0};
+        return ZE_RESULT_SUCCESS;
+    });
+
+    sampler.start();
+    EXPECT_TRUE(sampler.isRunning());
+    while (sampler.getSamplingRoundsCount() < 2) {
+        std::this_thread::yield();
+    }
+    sampler.stop();
+    EXPECT_FALSE(sampler.isRunning());
+
+    auto roundsCount = sampler.getSamplingRoundsCount();
+    EXPECT_EQ(roundsCount, value.load());
+    TelemetrySample sample;
+    EXPECT_TRUE(sampler.getLatestSample(metric, sample));
+    EXPECT_EQ(roundsCount, sample.value);
+}
+
+} // namespace ult
+} // namespace L0
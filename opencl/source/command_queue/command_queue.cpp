@@ -165,6 +165,7 @@ void CommandQueue::waitUntilComplete(uint32_t gpgpuTaskCountToWait, uint32_t bcs
 
     bool forcePowerSavingMode = this->throttle == QueueThrottle::LOW;
 
+    getGpgpuCommandStreamReceiver().flushAdaptiveBatchIfNeeded(gpgpuTaskCountToWait, &adaptiveDispatchStatistics);
     getGpgpuCommandStreamReceiver().waitForTaskCountWithKmdNotifyFallback(gpgpuTaskCountToWait, flushStampToWait,
                                                                           useQuickKmdSleep, forcePowerSavingMode);
     DEBUG_BREAK_IF(getHwTag() < gpgpuTaskCountToWait);
@@ -323,6 +323,8 @@ class CommandQueue : public BaseObject<_cl_command_queue> {
 
     uint64_t getSliceCount() const { return sliceCount; }
 
+    AdaptiveDispatchStatistics &getAdaptiveDispatchStatistics() { return adaptiveDispatchStatistics; }
+
     uint64_t dispatchHints = 0;
 
   protected:
@@ -359,6 +361,7 @@ class CommandQueue : public BaseObject<_cl_command_queue> {
     EnqueueProperties::Operation latestSentEnqueueType = EnqueueProperties::Operation::None;
     uint64_t sliceCount = QueueSliceCount::defaultSliceCount;
     uint32_t bcsTaskCount = 0;
+    AdaptiveDispatchStatistics adaptiveDispatchStatistics;
 
     bool perfCountersEnabled = false;
 
@@ -8,6 +8,7 @@
 #pragma once
 #include "shared/source/built_ins/built_ins.h"
 #include "shared/source/command_stream/command_stream_receiver.h"
+#include "shared/source/direct_submission/submission_timeline.h"
 #include "shared/source/helpers/array_count.h"
 #include "shared/source/helpers/engine_node_helper.h"
 #include "shared/source/memory_manager/internal_allocation_storage.h"
@@ -151,6 +152,7 @@ void CommandQueueHw<GfxFamily>::enqueueHandler(Surface **surfacesForResidency,
 
     TagNode<HwTimeStamps> *hwTimeStamps = nullptr;
 
+    SubmissionTimelineScope enqueueScope(SubmissionTimelineEvent::Enqueue, getGpgpuCommandStreamReceiver().getOsContextPtr());
     auto commandStreamRecieverOwnership = getGpgpuCommandStreamReceiver().obtainUniqueOwnership();
 
     EventBuilder eventBuilder;
@@ -325,6 +327,7 @@ void CommandQueueHw<GfxFamily>::enqueueHandler(Surface **surfacesForResidency,
         this->latestSentEnqueueType = enqueueProperties.operation;
     }
     updateFromCompletionStamp(completionStamp, eventBuilder.getEvent());
+    enqueueScope.setValue(completionStamp.taskCount);
 
     if (blockQueue) {
         if (parentKernel) {
@@ -774,6 +777,7 @@ CompletionStamp CommandQueueHw<GfxFamily>::enqueueNonBlocked(
         dispatchFlags.engineHints = this->dispatchHints;
         dispatchFlags.epilogueRequired = true;
     }
+    dispatchFlags.adaptiveDispatchStatistics = &adaptiveDispatchStatistics;
 
     if (gtpinIsGTPinInitialized()) {
         gtpinNotifyPreFlushTask(this);
@@ -971,6 +975,7 @@ CompletionStamp CommandQueueHw<GfxFamily>::enqueueCommandWithoutKernel(
             eventsRequest.fillCsrDependencies(dispatchFlags.csrDependencies, getGpgpuCommandStreamReceiver(), CsrDependencies::DependenciesType::OutOfCsr);
             dispatchFlags.csrDependencies.makeResident(getGpgpuCommandStreamReceiver());
         }
+        dispatchFlags.adaptiveDispatchStatistics = &adaptiveDispatchStatistics;
 
         completionStamp = getGpgpuCommandStreamReceiver().flushTask(
             *commandStream,
@@ -46,6 +46,7 @@ class TbxCommandStreamReceiverHw : public CommandStreamReceiverSimulatedHw<GfxFa
     void waitForTaskCountWithKmdNotifyFallback(uint32_t taskCountToWait, FlushStamp flushStampToWait, bool useQuickKmdSleep, bool forcePowerSavingMode) override;
     bool waitForCompletionWithTimeout(bool enableTimeout, int64_t timeoutMicroseconds, uint32_t taskCountToWait) override;
     void downloadAllocations() override;
+    void downloadAllocationIfPending(GraphicsAllocation &gfxAllocation) override;
 
     void processEviction() override;
     void processResidency(const ResidencyContainer &allocationsForResidency, uint32_t handleId) override;
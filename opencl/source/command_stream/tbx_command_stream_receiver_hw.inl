@@ -521,6 +521,8 @@ void TbxCommandStreamReceiverHw<GfxFamily>::downloadAllocation(GraphicsAllocatio
 
 template <typename GfxFamily>
 void TbxCommandStreamReceiverHw<GfxFamily>::downloadAllocations() {
+    //allocations scheduled for download are updated by flushes made under CSR ownership
+    auto lock = this->obtainUniqueOwnership();
     while (*this->getTagAddress() < this->latestFlushedTaskCount) {
         downloadAllocation(*this->getTagAllocation());
     }
@@ -530,6 +532,22 @@ void TbxCommandStreamReceiverHw<GfxFamily>::downloadAllocations() {
     this->allocationsForDownload.clear();
 }
 
+template <typename GfxFamily>
+void TbxCommandStreamReceiverHw<GfxFamily>::downloadAllocationIfPending(GraphicsAllocation &gfxAllocation) {
+    auto lock = this->obtainUniqueOwnership();
+    auto pendingAllocation = this->allocationsForDownload.find(&gfxAllocation);
+    if (pendingAllocation == this->allocationsForDownload.end()) {
+        return;
+    }
+
+    //tag is read first, so once it shows all flushed work completed the allocation content is final
+    downloadAllocation(*this->getTagAllocation());
+    downloadAllocation(gfxAllocation);
+    if (*this->getTagAddress() >= this->latestFlushedTaskCount) {
+        this->allocationsForDownload.erase(pendingAllocation);
+    }
+}
+
 template <typename GfxFamily>
 uint32_t TbxCommandStreamReceiverHw<GfxFamily>::getMaskAndValueForPollForCompletion() const {
     return 0x100;
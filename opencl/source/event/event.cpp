@@ -410,6 +410,14 @@ void Event::updateExecutionStatus() {
         return;
     }
 
+    if (cmdQueue != nullptr) {
+        //event is polled, so its batched work and work held back for coalescing must reach GPU
+        cmdQueue->getGpgpuCommandStreamReceiver().flushAdaptiveBatchIfNeeded(getCompletionStamp(), &cmdQueue->getAdaptiveDispatchStatistics());
+        cmdQueue->getGpgpuCommandStreamReceiver().flushCoalescedSubmissions();
+        if (cmdQueue->getBcsCommandStreamReceiver()) {
+            cmdQueue->getBcsCommandStreamReceiver()->flushCoalescedSubmissions();
+        }
+    }
     transitionExecutionStatus(CL_SUBMITTED);
 }
 
@@ -248,6 +248,7 @@ CompletionStamp &CommandComputeKernel::submit(uint32_t taskLevel, bool terminate
         dispatchFlags.engineHints = commandQueue.dispatchHints;
         dispatchFlags.epilogueRequired = true;
     }
+    dispatchFlags.adaptiveDispatchStatistics = &commandQueue.getAdaptiveDispatchStatistics();
 
     DEBUG_BREAK_IF(taskLevel >= CompletionStamp::notReady);
 
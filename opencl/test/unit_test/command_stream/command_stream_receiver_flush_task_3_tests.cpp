@@ -28,6 +28,8 @@
 #include "opencl/test/unit_test/mocks/mock_submissions_aggregator.h"
 #include "test.h"
 
+#include <limits>
+
 using namespace NEO;
 
 typedef UltCommandStreamReceiverTest CommandStreamReceiverFlushTaskTests;
@@ -1830,3 +1832,188 @@ HWTEST_F(CommandStreamReceiverFlushTaskTests, GivenGpuIsIdleWhenCsrIsEnabledToFl
 
     *commandStreamReceiver.getTagAddress() = 2u;
 }
+
+HWTEST_F(CommandStreamReceiverFlushTaskTests, givenAdaptiveDispatchDebugFlagsWhenCsrIsCreatedThenBatchLimitsAreOverridden) {
+    DebugManagerStateRestore restore;
+
+    MockCsrHw2<FamilyType> defaultCsr(*pDevice->executionEnvironment, pDevice->getRootDeviceIndex());
+    EXPECT_EQ(16u, defaultCsr.adaptiveDispatchMaxBatchSize);
+    EXPECT_EQ(500, defaultCsr.adaptiveDispatchMaxBatchAge);
+
+    DebugManager.flags.CsrAdaptiveDispatchMaxBatchSize.set(4);
+    DebugManager.flags.CsrAdaptiveDispatchMaxBatchAge.set(0);
+    MockCsrHw2<FamilyType> csr(*pDevice->executionEnvironment, pDevice->getRootDeviceIndex());
+    EXPECT_EQ(4u, csr.adaptiveDispatchMaxBatchSize);
+    EXPECT_EQ(0, csr.adaptiveDispatchMaxBatchAge);
+}
+
+HWTEST_F(CommandStreamReceiverFlushTaskTests, givenAdaptiveDispatchAndIdleGpuWhenFlushTaskIsCalledThenSubmissionIsFlushedImmediately) {
+    auto &commandStreamReceiver = pDevice->getUltCommandStreamReceiver<FamilyType>();
+    commandStreamReceiver.dispatchMode = DispatchMode::AdaptiveDispatch;
+    commandStreamReceiver.useNewResourceImplicitFlush = false;
+    commandStreamReceiver.useGpuIdleImplicitFlush = false;
+    commandStreamReceiver.latestFlushedTaskCount = 1u;
+    *commandStreamReceiver.getTagAddress() = 1u;
+
+    flushTask(commandStreamReceiver);
+
+    EXPECT_TRUE(commandStreamReceiver.flushBatchedSubmissionsCalled);
+    EXPECT_TRUE(commandStreamReceiver.submissionAggregator->peekCmdBufferList().peekIsEmpty());
+    EXPECT_EQ(1u, commandStreamReceiver.getAdaptiveDispatchStatistics().idleFlushes);
+    EXPECT_EQ(0u, commandStreamReceiver.getAdaptiveDispatchStatistics().batchedSubmissions);
+    EXPECT_EQ(0u, commandStreamReceiver.adaptiveBatchSize);
+
+    *commandStreamReceiver.getTagAddress() = commandStreamReceiver.peekTaskCount();
+}
+
+HWTEST_F(CommandStreamReceiverFlushTaskTests, givenAdaptiveDispatchAndBusyGpuWhenFlushTaskIsCalledThenSubmissionIsBatched) {
+    auto &commandStreamReceiver = pDevice->getUltCommandStreamReceiver<FamilyType>();
+    commandStreamReceiver.dispatchMode = DispatchMode::AdaptiveDispatch;
+    commandStreamReceiver.useNewResourceImplicitFlush = false;
+    commandStreamReceiver.useGpuIdleImplicitFlush = false;
+    commandStreamReceiver.adaptiveDispatchMaxBatchAge = std::numeric_limits<int64_t>::max();
+    commandStreamReceiver.latestFlushedTaskCount = 5u;
+    *commandStreamReceiver.getTagAddress() = 0u;
+
+    flushTask(commandStreamReceiver);
+
+    EXPECT_FALSE(commandStreamReceiver.flushBatchedSubmissionsCalled);
+    EXPECT_FALSE(commandStreamReceiver.submissionAggregator->peekCmdBufferList().peekIsEmpty());
+    EXPECT_EQ(1u, commandStreamReceiver.getAdaptiveDispatchStatistics().batchedSubmissions);
+    EXPECT_EQ(1u, commandStreamReceiver.adaptiveBatchSize);
+
+    *commandStreamReceiver.getTagAddress() = 5u;
+}
+
+HWTEST_F(CommandStreamReceiverFlushTaskTests, givenAdaptiveDispatchAndBusyGpuWhenBatchSizeLimitIsReachedThenSubmissionsAreFlushed) {
+    auto &commandStreamReceiver = pDevice->getUltCommandStreamReceiver<FamilyType>();
+    commandStreamReceiver.dispatchMode = DispatchMode::AdaptiveDispatch;
+    commandStreamReceiver.useNewResourceImplicitFlush = false;
+    commandStreamReceiver.useGpuIdleImplicitFlush = false;
+    commandStreamReceiver.adaptiveDispatchMaxBatchAge = std::numeric_limits<int64_t>::max();
+    commandStreamReceiver.adaptiveDispatchMaxBatchSize = 2u;
+    commandStreamReceiver.latestFlushedTaskCount = 5u;
+    *commandStreamReceiver.getTagAddress() = 0u;
+
+    flushTask(commandStreamReceiver);
+    EXPECT_FALSE(commandStreamReceiver.flushBatchedSubmissionsCalled);
+
+    flushTask(commandStreamReceiver);
+    EXPECT_TRUE(commandStreamReceiver.flushBatchedSubmissionsCalled);
+    EXPECT_TRUE(commandStreamReceiver.submissionAggregator->peekCmdBufferList().peekIsEmpty());
+    EXPECT_EQ(1u, commandStreamReceiver.getAdaptiveDispatchStatistics().batchedSubmissions);
+    EXPECT_EQ(1u, commandStreamReceiver.getAdaptiveDispatchStatistics().batchSizeFlushes);
+    EXPECT_EQ(0u, commandStreamReceiver.adaptiveBatchSize);
+
+    *commandStreamReceiver.getTagAddress() = 5u;
+}
+
+HWTEST_F(CommandStreamReceiverFlushTaskTests, givenAdaptiveDispatchAndBusyGpuWhenBatchAgeLimitIsReachedThenSubmissionsAreFlushed) {
+    auto &commandStreamReceiver = pDevice->getUltCommandStreamReceiver<FamilyType>();
+    commandStreamReceiver.dispatchMode = DispatchMode::AdaptiveDispatch;
+    commandStreamReceiver.useNewResourceImplicitFlush = false;
+    commandStreamReceiver.useGpuIdleImplicitFlush = false;
+    commandStreamReceiver.adaptiveDispatchMaxBatchAge = 0;
+    commandStreamReceiver.latestFlushedTaskCount = 5u;
+    *commandStreamReceiver.getTagAddress() = 0u;
+
+    flushTask(commandStreamReceiver);
+
+    EXPECT_TRUE(commandStreamReceiver.flushBatchedSubmissionsCalled);
+    EXPECT_EQ(1u, commandStreamReceiver.getAdaptiveDispatchStatistics().batchAgeFlushes);
+    EXPECT_EQ(0u, commandStreamReceiver.getAdaptiveDispatchStatistics().batchedSubmissions);
+
+    *commandStreamReceiver.getTagAddress() = 5u;
+}
+
+HWTEST_F(CommandStreamReceiverFlushTaskTests, givenAdaptiveDispatchAndImplicitFlushRequestedWhenFlushTaskIsCalledThenNoPolicyDecisionIsCounted) {
+    auto &commandStreamReceiver = pDevice->getUltCommandStreamReceiver<FamilyType>();
+    commandStreamReceiver.dispatchMode = DispatchMode::AdaptiveDispatch;
+    commandStreamReceiver.useNewResourceImplicitFlush = false;
+    commandStreamReceiver.useGpuIdleImplicitFlush = false;
+    commandStreamReceiver.latestFlushedTaskCount = 5u;
+    *commandStreamReceiver.getTagAddress() = 0u;
+
+    AdaptiveDispatchStatistics queueStatistics;
+    flushTaskFlags.adaptiveDispatchStatistics = &queueStatistics;
+    flushTaskFlags.implicitFlush = true;
+    flushTask(commandStreamReceiver);
+
+    EXPECT_TRUE(commandStreamReceiver.flushBatchedSubmissionsCalled);
+    auto &statistics = commandStreamReceiver.getAdaptiveDispatchStatistics();
+    EXPECT_EQ(0u, statistics.batchedSubmissions + statistics.idleFlushes + statistics.batchSizeFlushes + statistics.batchAgeFlushes);
+    EXPECT_EQ(0u, queueStatistics.batchedSubmissions + queueStatistics.idleFlushes + queueStatistics.batchSizeFlushes + queueStatistics.batchAgeFlushes);
+    EXPECT_EQ(0u, commandStreamReceiver.adaptiveBatchSize);
+
+    *commandStreamReceiver.getTagAddress() = commandStreamReceiver.peekTaskCount();
+}
+
+HWTEST_F(CommandStreamReceiverFlushTaskTests, givenAdaptiveDispatchAndQueueStatisticsWhenSubmissionIsBatchedThenDecisionIsCountedForQueueAndCsr) {
+    auto &commandStreamReceiver = pDevice->getUltCommandStreamReceiver<FamilyType>();
+    commandStreamReceiver.dispatchMode = DispatchMode::AdaptiveDispatch;
+    commandStreamReceiver.useNewResourceImplicitFlush = false;
+    commandStreamReceiver.useGpuIdleImplicitFlush = false;
+    commandStreamReceiver.adaptiveDispatchMaxBatchAge = std::numeric_limits<int64_t>::max();
+    commandStreamReceiver.latestFlushedTaskCount = 5u;
+    *commandStreamReceiver.getTagAddress() = 0u;
+
+    AdaptiveDispatchStatistics queueStatistics;
+    AdaptiveDispatchStatistics otherQueueStatistics;
+    flushTaskFlags.adaptiveDispatchStatistics = &queueStatistics;
+    flushTask(commandStreamReceiver);
+    flushTaskFlags.adaptiveDispatchStatistics = &otherQueueStatistics;
+    flushTask(commandStreamReceiver);
+
+    EXPECT_EQ(1u, queueStatistics.batchedSubmissions);
+    EXPECT_EQ(1u, otherQueueStatistics.batchedSubmissions);
+    EXPECT_EQ(2u, commandStreamReceiver.getAdaptiveDispatchStatistics().batchedSubmissions);
+
+    *commandStreamReceiver.getTagAddress() = 5u;
+}
+
+HWTEST_F(CommandStreamReceiverFlushTaskTests, givenAdaptiveDispatchAndBatchedSubmissionWhenWaitingForItThenBatchIsFlushedAsWaitDecision) {
+    auto &commandStreamReceiver = pDevice->getUltCommandStreamReceiver<FamilyType>();
+    commandStreamReceiver.dispatchMode = DispatchMode::AdaptiveDispatch;
+    commandStreamReceiver.useNewResourceImplicitFlush = false;
+    commandStreamReceiver.useGpuIdleImplicitFlush = false;
+    commandStreamReceiver.adaptiveDispatchMaxBatchAge = std::numeric_limits<int64_t>::max();
+    commandStreamReceiver.latestFlushedTaskCount = 5u;
+    *commandStreamReceiver.getTagAddress() = 0u;
+
+    flushTask(commandStreamReceiver);
+    EXPECT_FALSE(commandStreamReceiver.flushBatchedSubmissionsCalled);
+
+    AdaptiveDispatchStatistics queueStatistics;
+    EXPECT_TRUE(commandStreamReceiver.flushAdaptiveBatchIfNeeded(commandStreamReceiver.peekTaskCount(), &queueStatistics));
+
+    EXPECT_TRUE(commandStreamReceiver.flushBatchedSubmissionsCalled);
+    EXPECT_TRUE(commandStreamReceiver.submissionAggregator->peekCmdBufferList().peekIsEmpty());
+    EXPECT_EQ(1u, queueStatistics.waitFlushes);
+    EXPECT_EQ(1u, commandStreamReceiver.getAdaptiveDispatchStatistics().waitFlushes);
+    EXPECT_EQ(0u, commandStreamReceiver.adaptiveBatchSize);
+
+    *commandStreamReceiver.getTagAddress() = commandStreamReceiver.peekTaskCount();
+}
+
+HWTEST_F(CommandStreamReceiverFlushTaskTests, givenAdaptiveDispatchAndBatchedSubmissionWhenGpuBecomesIdleBeforeWaitOnOlderWorkThenBatchIsFlushedAsIdleDecision) {
+    auto &commandStreamReceiver = pDevice->getUltCommandStreamReceiver<FamilyType>();
+    commandStreamReceiver.dispatchMode = DispatchMode::AdaptiveDispatch;
+    commandStreamReceiver.useNewResourceImplicitFlush = false;
+    commandStreamReceiver.useGpuIdleImplicitFlush = false;
+    commandStreamReceiver.adaptiveDispatchMaxBatchAge = std::numeric_limits<int64_t>::max();
+    commandStreamReceiver.latestFlushedTaskCount = 5u;
+    *commandStreamReceiver.getTagAddress() = 0u;
+
+    flushTask(commandStreamReceiver);
+    EXPECT_TRUE(commandStreamReceiver.flushAdaptiveBatchIfNeeded(1u, nullptr));
+    EXPECT_FALSE(commandStreamReceiver.flushBatchedSubmissionsCalled);
+
+    *commandStreamReceiver.getTagAddress() = 5u;
+    EXPECT_TRUE(commandStreamReceiver.flushAdaptiveBatchIfNeeded(1u, nullptr));
+
+    EXPECT_TRUE(commandStreamReceiver.flushBatchedSubmissionsCalled);
+    EXPECT_EQ(1u, commandStreamReceiver.getAdaptiveDispatchStatistics().idleFlushes);
+    EXPECT_EQ(0u, commandStreamReceiver.getAdaptiveDispatchStatistics().waitFlushes);
+
+    *commandStreamReceiver.getTagAddress() = commandStreamReceiver.peekTaskCount();
+}
@@ -9,6 +9,7 @@
 #include "shared/source/command_stream/linear_stream.h"
 #include "shared/source/command_stream/preemption.h"
 #include "shared/source/command_stream/scratch_space_controller.h"
+#include "shared/source/direct_submission/submission_timeline.h"
 #include "shared/source/gmm_helper/page_table_mngr.h"
 #include "shared/source/helpers/cache_policy.h"
 #include "shared/source/helpers/hw_helper.h"
@@ -44,6 +45,8 @@
 #include "command_stream_receiver_simulated_hw.h"
 #include "gmock/gmock.h"
 
+#include <sstream>
+
 using namespace NEO;
 
 struct CommandStreamReceiverTest : public ClDeviceFixture,
@@ -309,6 +312,32 @@ HWTEST_F(CommandStreamReceiverTest, givenDebugVariableEnabledWhenCreatingCsrThen
     EXPECT_FALSE(csr2.peekTimestampPacketWriteEnabled());
 }
 
+TEST_F(CommandStreamReceiverTest, givenSubmissionTimelineEnabledWhenWaitingForTaskCountThenTagCompletionIsRecordedOnceForCompletedTaskCount) {
+    DebugManagerStateRestore restore;
+    DebugManager.flags.EnableSubmissionTimeline.set(true);
+    SubmissionTimeline::getInstance().reset();
+
+    auto tagAllocation = commandStreamReceiver->getTagAllocation();
+    auto timestampOffset = commandStreamReceiver->getCompletionTimestampGPUAddress(3u) - tagAllocation->getGpuAddress();
+    auto timestamp = reinterpret_cast<uint64_t *>(ptrOffset(tagAllocation->getUnderlyingBuffer(), static_cast<size_t>(timestampOffset)));
+    *timestamp = 1u;
+    commandStreamReceiver->prepareCompletionTimestamp(*pDevice, 3u);
+    EXPECT_EQ(0u, *timestamp);
+
+    *commandStreamReceiver->getTagAddress() = 3u;
+    EXPECT_TRUE(commandStreamReceiver->waitForCompletionWithTimeout(false, 0, 2u));
+    EXPECT_TRUE(commandStreamReceiver->waitForCompletionWithTimeout(false, 0, 3u));
+
+    std::stringstream stream;
+    SubmissionTimeline::getInstance().exportChromeTrace(stream);
+    SubmissionTimeline::getInstance().reset();
+    auto trace = stream.str();
+    auto tagCompletion = trace.find("\"name\":\"tagCompletion\"");
+    ASSERT_NE(std::string::npos, tagCompletion);
+    EXPECT_EQ(std::string::npos, trace.find("\"name\":\"tagCompletion\"", tagCompletion + 1));
+    EXPECT_NE(std::string::npos, trace.find("{\"value\":3}"));
+}
+
 HWTEST_F(CommandStreamReceiverTest, whenDirectSubmissionDisabledThenExpectNoFeatureAvailable) {
     DeviceFactory::prepareDeviceEnvironments(*pDevice->getExecutionEnvironment());
     CommandStreamReceiverHw<FamilyType> csr(*pDevice->executionEnvironment, pDevice->getRootDeviceIndex());
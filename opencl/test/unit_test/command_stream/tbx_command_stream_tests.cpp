@@ -454,11 +454,73 @@ HWTEST_F(TbxCommandSteamSimpleTest, givenTbxCsrWhenDownloadAllocatoinsCalledThen
     tbxCsr.allocationsForDownload = {&allocation1, &allocation2, &allocation3};
 
     tbxCsr.downloadAllocations();
+    EXPECT_EQ(1u, tbxCsr.obtainUniqueOwnershipCalled);
 
     std::set<GraphicsAllocation *> expectedDownloadedAllocations = {tbxCsr.getTagAllocation(), &allocation1, &allocation2, &allocation3};
     EXPECT_EQ(0u, tbxCsr.allocationsForDownload.size());
 }
 
+HWTEST_F(TbxCommandSteamSimpleTest, givenTbxCsrWhenDownloadAllocationIfPendingCalledForScheduledAllocationThenOnlyTagAndThisAllocationAreDownloaded) {
+    MockTbxCsrRegisterDownloadedAllocations<FamilyType> tbxCsr{*pDevice->executionEnvironment, pDevice->getRootDeviceIndex()};
+    MockOsContext osContext(0, 1, aub_stream::ENGINE_RCS, PreemptionMode::Disabled, false, false, false);
+    uint32_t tag = 0u;
+    tbxCsr.setupContext(osContext);
+    tbxCsr.setTagAllocation(pDevice->getMemoryManager()->allocateGraphicsMemoryWithProperties(MockAllocationProperties{pDevice->getRootDeviceIndex(), false, sizeof(tag), pDevice->getDeviceBitfield()}, &tag));
+
+    MockGraphicsAllocation allocation1, allocation2;
+    tbxCsr.allocationsForDownload = {&allocation1, &allocation2};
+
+    tbxCsr.downloadAllocationIfPending(allocation1);
+    EXPECT_EQ(1u, tbxCsr.obtainUniqueOwnershipCalled);
+
+    std::set<GraphicsAllocation *> expectedDownloadedAllocations = {tbxCsr.getTagAllocation(), &allocation1};
+    EXPECT_EQ(expectedDownloadedAllocations, tbxCsr.downloadedAllocations);
+    std::set<GraphicsAllocation *> expectedAllocationsForDownload = {&allocation2};
+    EXPECT_EQ(expectedAllocationsForDownload, tbxCsr.allocationsForDownload);
+}
+
+HWTEST_F(TbxCommandSteamSimpleTest, givenTbxCsrWhenDownloadAllocationIfPendingCalledForNotScheduledAllocationThenNothingIsDownloaded) {
+    MockTbxCsrRegisterDownloadedAllocations<FamilyType> tbxCsr{*pDevice->executionEnvironment, pDevice->getRootDeviceIndex()};
+    MockOsContext osContext(0, 1, aub_stream::ENGINE_RCS, PreemptionMode::Disabled, false, false, false);
+    uint32_t tag = 0u;
+    tbxCsr.setupContext(osContext);
+    tbxCsr.setTagAllocation(pDevice->getMemoryManager()->allocateGraphicsMemoryWithProperties(MockAllocationProperties{pDevice->getRootDeviceIndex(), false, sizeof(tag), pDevice->getDeviceBitfield()}, &tag));
+
+    MockGraphicsAllocation allocation1, allocation2;
+    tbxCsr.allocationsForDownload = {&allocation2};
+
+    tbxCsr.downloadAllocationIfPending(allocation1);
+
+    EXPECT_EQ(0u, tbxCsr.downloadedAllocations.size());
+    EXPECT_EQ(1u, tbxCsr.allocationsForDownload.size());
+}
+
+HWTEST_F(TbxCommandSteamSimpleTest, givenTbxCsrWithWorkInProgressWhenDownloadAllocationIfPendingCalledThenAllocationStaysScheduledForDownload) {
+    struct MockTbxCsrWithBusyTag : TbxCommandStreamReceiverHw<FamilyType> {
+        using TbxCommandStreamReceiverHw<FamilyType>::TbxCommandStreamReceiverHw;
+        using CommandStreamReceiver::latestFlushedTaskCount;
+        void downloadAllocation(GraphicsAllocation &gfxAllocation) override {
+            downloadAllocationCalled++;
+        }
+        uint32_t downloadAllocationCalled = 0u;
+    };
+
+    MockTbxCsrWithBusyTag tbxCsr{*pDevice->executionEnvironment, pDevice->getRootDeviceIndex()};
+    MockOsContext osContext(0, 1, aub_stream::ENGINE_RCS, PreemptionMode::Disabled, false, false, false);
+    uint32_t tag = 0u;
+    tbxCsr.setupContext(osContext);
+    tbxCsr.setTagAllocation(pDevice->getMemoryManager()->allocateGraphicsMemoryWithProperties(MockAllocationProperties{pDevice->getRootDeviceIndex(), false, sizeof(tag), pDevice->getDeviceBitfield()}, &tag));
+    tbxCsr.latestFlushedTaskCount = 1u;
+
+    MockGraphicsAllocation allocation;
+    tbxCsr.allocationsForDownload = {&allocation};
+
+    tbxCsr.downloadAllocationIfPending(allocation);
+
+    EXPECT_EQ(2u, tbxCsr.downloadAllocationCalled);
+    EXPECT_EQ(1u, tbxCsr.allocationsForDownload.size());
+}
+
 HWTEST_F(TbxCommandSteamSimpleTest, whenTbxCommandStreamReceiverIsCreatedThenPPGTTAndGGTTCreatedHavePhysicalAddressAllocatorSet) {
     MockTbxCsr<FamilyType> tbxCsr(*pDevice->executionEnvironment);
 
@@ -83,7 +83,12 @@ struct MockTbxCsrRegisterDownloadedAllocations : TbxCommandStreamReceiverHw<GfxF
         flushBatchedSubmissionsCalled = true;
         return true;
     }
+    std::unique_lock<CommandStreamReceiver::MutexType> obtainUniqueOwnership() override {
+        obtainUniqueOwnershipCalled++;
+        return TbxCommandStreamReceiverHw<GfxFamily>::obtainUniqueOwnership();
+    }
     std::set<GraphicsAllocation *> downloadedAllocations;
     bool flushBatchedSubmissionsCalled = false;
+    uint32_t obtainUniqueOwnershipCalled = 0;
 };
 } // namespace NEO
@@ -15,6 +15,7 @@
 #include "shared/source/helpers/heap_helper.h"
 #include "shared/source/helpers/hw_helper.h"
 #include "shared/source/indirect_heap/indirect_heap.h"
+#include "shared/source/memory_manager/internal_allocation_storage.h"
 #include "shared/source/memory_manager/memory_manager.h"
 
 namespace NEO {
@@ -141,6 +142,48 @@ void CommandContainer::reset() {
     iddBlock = nullptr;
     nextIddInBlock = this->getNumIddPerBlock();
     lastSentNumGrfRequired = 0;
+    lastDispatchState.invalidate();
+}
+
+void CommandContainer::storeAllocationsForReuse(InternalAllocationStorage &storage, uint32_t taskCount) {
+    //buffers may still be consumed by GPU, they become reusable once taskCount completes
+    size_t alignedSize = alignUp<size_t>(totalCmdBufferSize, MemoryConstants::pageSize64k);
+    for (auto cmdBufferAllocation : cmdBufferAllocations) {
+        storage.storeAllocationWithTaskCount(std::unique_ptr<GraphicsAllocation>(cmdBufferAllocation), REUSABLE_ALLOCATION, taskCount);
+    }
+    cmdBufferAllocations.clear();
+
+    auto cmdBufferAllocation = storage.obtainReusableAllocation(alignedSize, GraphicsAllocation::AllocationType::COMMAND_BUFFER).release();
+    if (cmdBufferAllocation == nullptr) {
+        AllocationProperties properties{device->getRootDeviceIndex(),
+                                        true /* allocateMemory*/,
+                                        alignedSize,
+                                        GraphicsAllocation::AllocationType::COMMAND_BUFFER,
+                                        (device->getNumAvailableDevices() > 1u) /* multiOsContextCapable */,
+                                        false,
+                                        device->getDeviceBitfield()};
+        cmdBufferAllocation = device->getMemoryManager()->allocateGraphicsMemoryWithProperties(properties);
+    }
+    UNRECOVERABLE_IF(!cmdBufferAllocation);
+    cmdBufferAllocations.push_back(cmdBufferAllocation);
+    commandStream->replaceGraphicsAllocation(cmdBufferAllocation);
+
+    for (uint32_t i = 0; i < IndirectHeap::Type::NUM_TYPES; i++) {
+        auto oldAlloc = allocationIndirectHeaps[i];
+        auto heapSize = oldAlloc->getUnderlyingBufferSize();
+        auto heapAllocationType = oldAlloc->getAllocationType();
+        storage.storeAllocationWithTaskCount(std::unique_ptr<GraphicsAllocation>(oldAlloc), REUSABLE_ALLOCATION, taskCount);
+
+        auto newAlloc = storage.obtainReusableAllocation(heapSize, heapAllocationType).release();
+        if (newAlloc == nullptr) {
+            newAlloc = heapHelper->getHeapAllocation(i, heapSize, alignedSize, device->getRootDeviceIndex());
+        }
+        UNRECOVERABLE_IF(!newAlloc);
+        indirectHeaps[i]->replaceGraphicsAllocation(newAlloc);
+        indirectHeaps[i]->replaceBuffer(newAlloc->getUnderlyingBuffer(), newAlloc->getUnderlyingBufferSize());
+        allocationIndirectHeaps[i] = newAlloc;
+    }
+    lastDispatchState.invalidate();
 }
 
 void *CommandContainer::getHeapSpaceAllowGrow(HeapType heapType,
@@ -19,6 +19,7 @@
 namespace NEO {
 class Device;
 class GraphicsAllocation;
+class InternalAllocationStorage;
 class LinearStream;
 
 using ResidencyContainer = std::vector<GraphicsAllocation *>;
@@ -86,12 +87,30 @@ class CommandContainer : public NonCopyableOrMovableClass {
     uint32_t nextIddInBlock = 0;
     uint32_t lastSentNumGrfRequired = 0;
 
+    //consecutive dispatches with identical state share interface descriptor and binding table of the previous one
+    struct DispatchStateCache {
+        std::vector<uint8_t> surfaceStateHeapData;
+        GraphicsAllocation *surfaceStateHeapAllocation = nullptr;
+        size_t surfaceStateHeapOffset = 0u;
+        uint32_t bindingTablePointer = 0u;
+        std::vector<uint8_t> interfaceDescriptorData;
+        void *iddBlock = nullptr;
+        uint32_t iddOffset = 0u;
+
+        void invalidate() {
+            surfaceStateHeapAllocation = nullptr;
+            iddBlock = nullptr;
+        }
+    };
+    DispatchStateCache lastDispatchState;
+
     Device *getDevice() const { return device; }
 
     IndirectHeap *getHeapWithRequiredSizeAndAlignment(HeapType heapType, size_t sizeRequired, size_t alignment);
     void allocateNextCommandBuffer();
 
     void reset();
+    void storeAllocationsForReuse(InternalAllocationStorage &storage, uint32_t taskCount);
 
     bool isHeapDirty(HeapType heapType) const { return (dirtyHeaps & (1u << heapType)); }
     bool isAnyHeapDirty() const { return dirtyHeaps != 0; }
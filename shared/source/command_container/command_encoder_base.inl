@@ -9,6 +9,7 @@
 #include "shared/source/command_container/command_encoder.h"
 #include "shared/source/command_stream/linear_stream.h"
 #include "shared/source/command_stream/preemption.h"
+#include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/execution_environment/execution_environment.h"
 #include "shared/source/gmm_helper/gmm_helper.h"
 #include "shared/source/helpers/hw_helper.h"
@@ -55,7 +56,7 @@ void EncodeDispatchKernel<Family>::encode(CommandContainer &container,
     {
         auto alloc = dispatchInterface->getIsaAllocation();
         UNRECOVERABLE_IF(nullptr == alloc);
-        auto offset = alloc->getGpuAddressToPatch();
+        auto offset = alloc->getGpuAddressToPatch() + dispatchInterface->getIsaOffsetInParentAllocation();
         idd.setKernelStartPointer(offset);
         idd.setKernelStartPointerHigh(0u);
     }
@@ -77,18 +78,41 @@ void EncodeDispatchKernel<Family>::encode(CommandContainer &container,
             ? slmSize
             : INTERFACE_DESCRIPTOR_DATA::SHARED_LOCAL_MEMORY_SIZE_ENCODES_0K);
 
+    auto &lastDispatchState = container.lastDispatchState;
+    bool reuseDispatchState = DebugManager.flags.EnableDispatchStateReuse.get();
+
     {
         uint32_t bindingTableStateCount = kernelDescriptor.payloadMappings.bindingTable.numEntries;
         uint32_t bindingTablePointer = 0u;
 
         if (bindingTableStateCount > 0u) {
-            auto ssh = container.getHeapWithRequiredSizeAndAlignment(HeapType::SURFACE_STATE, dispatchInterface->getSurfaceStateHeapDataSize(), BINDING_TABLE_STATE::SURFACESTATEPOINTER_ALIGN_SIZE);
-            sshOffset = ssh->getUsed();
-            bindingTablePointer = static_cast<uint32_t>(EncodeSurfaceState<Family>::pushBindingTableAndSurfaceStates(
-                *ssh, bindingTableStateCount,
-                dispatchInterface->getSurfaceStateHeapData(),
-                dispatchInterface->getSurfaceStateHeapDataSize(), bindingTableStateCount,
-                kernelDescriptor.payloadMappings.bindingTable.tableOffset));
+            auto sshDataSize = dispatchInterface->getSurfaceStateHeapDataSize();
+            auto sshData = dispatchInterface->getSurfaceStateHeapData();
+            auto ssh = container.getHeapWithRequiredSizeAndAlignment(HeapType::SURFACE_STATE, sshDataSize, BINDING_TABLE_STATE::SURFACESTATEPOINTER_ALIGN_SIZE);
+
+            if (reuseDispatchState &&
+                lastDispatchState.surfaceStateHeapAllocation == ssh->getGraphicsAllocation() &&
+                lastDispatchState.surfaceStateHeapData.size() == sshDataSize &&
+                memcmp(lastDispatchState.surfaceStateHeapData.data(), sshData, sshDataSize) == 0) {
+                sshOffset = lastDispatchState.surfaceStateHeapOffset;
+                bindingTablePointer = lastDispatchState.bindingTablePointer;
+            } else {
+                sshOffset = ssh->getUsed();
+                bindingTablePointer = static_cast<uint32_t>(EncodeSurfaceState<Family>::pushBindingTableAndSurfaceStates(
+                    *ssh, bindingTableStateCount,
+                    sshData,
+                    sshDataSize, bindingTableStateCount,
+                    kernelDescriptor.payloadMappings.bindingTable.tableOffset));
+
+                lastDispatchState.surfaceStateHeapAllocation = ssh->getGraphicsAllocation();
+                lastDispatchState.surfaceStateHeapOffset = sshOffset;
+                lastDispatchState.bindingTablePointer = bindingTablePointer;
+                if (reuseDispatchState) {
+                    lastDispatchState.surfaceStateHeapData.assign(sshData, sshData + sshDataSize);
+                } else {
+                    lastDispatchState.surfaceStateHeapData.clear();
+                }
+            }
         }
 
         idd.setBindingTablePointer(bindingTablePointer);
@@ -184,8 +208,22 @@ void EncodeDispatchKernel<Family>::encode(CommandContainer &container,
     }
 
     uint32_t numIDD = 0u;
-    void *ptr = getInterfaceDescriptor(container, numIDD);
-    memcpy_s(ptr, sizeof(idd), &idd, sizeof(idd));
+    if (reuseDispatchState &&
+        lastDispatchState.iddBlock != nullptr && lastDispatchState.iddBlock == container.getIddBlock() &&
+        lastDispatchState.interfaceDescriptorData.size() == sizeof(idd) &&
+        memcmp(lastDispatchState.interfaceDescriptorData.data(), &idd, sizeof(idd)) == 0) {
+        numIDD = lastDispatchState.iddOffset;
+    } else {
+        void *ptr = getInterfaceDescriptor(container, numIDD);
+        memcpy_s(ptr, sizeof(idd), &idd, sizeof(idd));
+
+        if (reuseDispatchState) {
+            auto iddData = reinterpret_cast<const uint8_t *>(&idd);
+            lastDispatchState.interfaceDescriptorData.assign(iddData, iddData + sizeof(idd));
+            lastDispatchState.iddBlock = container.getIddBlock();
+            lastDispatchState.iddOffset = numIDD;
+        }
+    }
 
     cmd.setIndirectDataStartAddress(static_cast<uint32_t>(offsetThreadData));
     cmd.setIndirectDataLength(sizeThreadData);
@@ -12,11 +12,13 @@
 #include "shared/source/command_stream/preemption.h"
 #include "shared/source/command_stream/scratch_space_controller.h"
 #include "shared/source/device/device.h"
+#include "shared/source/direct_submission/submission_timeline.h"
 #include "shared/source/execution_environment/root_device_environment.h"
 #include "shared/source/helpers/array_count.h"
 #include "shared/source/helpers/cache_policy.h"
 #include "shared/source/helpers/flush_stamp.h"
 #include "shared/source/helpers/hw_helper.h"
+#include "shared/source/helpers/ptr_math.h"
 #include "shared/source/helpers/string.h"
 #include "shared/source/helpers/timestamp_packet.h"
 #include "shared/source/memory_manager/internal_allocation_storage.h"
@@ -24,9 +26,12 @@
 #include "shared/source/memory_manager/surface.h"
 #include "shared/source/os_interface/os_context.h"
 #include "shared/source/os_interface/os_interface.h"
+#include "shared/source/os_interface/os_time.h"
 #include "shared/source/utilities/cpuintrinsics.h"
 #include "shared/source/utilities/tag_allocator.h"
 
+#include <algorithm>
+
 namespace NEO {
 
 // Global table of CommandStreamReceiver factories for HW and tests
@@ -41,6 +46,12 @@ CommandStreamReceiver::CommandStreamReceiver(ExecutionEnvironment &executionEnvi
     if (DebugManager.flags.CsrDispatchMode.get()) {
         this->dispatchMode = (DispatchMode)DebugManager.flags.CsrDispatchMode.get();
     }
+    if (DebugManager.flags.CsrAdaptiveDispatchMaxBatchSize.get() != -1) {
+        this->adaptiveDispatchMaxBatchSize = static_cast<uint32_t>(std::max(DebugManager.flags.CsrAdaptiveDispatchMaxBatchSize.get(), 1));
+    }
+    if (DebugManager.flags.CsrAdaptiveDispatchMaxBatchAge.get() != -1) {
+        this->adaptiveDispatchMaxBatchAge = DebugManager.flags.CsrAdaptiveDispatchMaxBatchAge.get();
+    }
     flushStamp.reset(new FlushStampTracker(true));
     for (int i = 0; i < IndirectHeap::NUM_TYPES; ++i) {
         indirectHeap[i] = nullptr;
@@ -217,6 +228,10 @@ bool CommandStreamReceiver::waitForCompletionWithTimeout(bool enableTimeout, int
     std::chrono::high_resolution_clock::time_point time1, time2;
     int64_t timeDiff = 0;
 
+    if (!flushAdaptiveBatchIfNeeded(taskCountToWait, nullptr)) {
+        return false;
+    }
+
     uint32_t latestSentTaskCount = this->latestFlushedTaskCount;
     if (latestSentTaskCount < taskCountToWait) {
         if (!this->flushBatchedSubmissions()) {
@@ -234,12 +249,46 @@ bool CommandStreamReceiver::waitForCompletionWithTimeout(bool enableTimeout, int
             timeDiff = std::chrono::duration_cast<std::chrono::microseconds>(time2 - time1).count();
         }
     }
-    if (*getTagAddress() >= taskCountToWait) {
+    auto completedTaskCount = *getTagAddress();
+    if (completedTaskCount >= taskCountToWait) {
+        recordTagCompletion(completedTaskCount);
         return true;
     }
     return false;
 }
 
+void CommandStreamReceiver::prepareCompletionTimestamp(Device &device, uint32_t taskCountToWrite) {
+    if (!timelineClock.isCaptured()) {
+        TimeStampData gpuCpuTime = {};
+        if (device.getOSTime() && device.getOSTime()->getCpuGpuTime(&gpuCpuTime)) {
+            timelineClock.capture(gpuCpuTime.GPUTimeStamp, device.getProfilingTimerResolution());
+        }
+    }
+    //zero marks timestamp not written by GPU, e.g. when tag is updated by other path
+    auto timestamp = ptrOffset(tagAllocation->getUnderlyingBuffer(), getCompletionTimestampOffset(taskCountToWrite));
+    *reinterpret_cast<volatile uint64_t *>(timestamp) = 0u;
+}
+
+void CommandStreamReceiver::recordTagCompletion(uint32_t completedTaskCount) {
+    if (!SubmissionTimeline::isEnabled()) {
+        return;
+    }
+    auto lastRecorded = lastRecordedTagCompletion.load(std::memory_order_relaxed);
+    do {
+        if (completedTaskCount <= lastRecorded) {
+            return;
+        }
+    } while (!lastRecordedTagCompletion.compare_exchange_weak(lastRecorded, completedTaskCount));
+
+    auto timestamp = ptrOffset(tagAllocation->getUnderlyingBuffer(), getCompletionTimestampOffset(completedTaskCount));
+    auto gpuTimestamp = *reinterpret_cast<volatile uint64_t *>(timestamp);
+    int64_t completionTime = 0;
+    if (!timelineClock.convert(gpuTimestamp, completionTime)) {
+        completionTime = SubmissionTimeline::getTimestamp();
+    }
+    SubmissionTimeline::getInstance().record(SubmissionTimelineEvent::TagCompletion, SubmissionTimeline::getEngineId(osContext), completedTaskCount, completionTime, 0);
+}
+
 void CommandStreamReceiver::setTagAllocation(GraphicsAllocation *allocation) {
     this->tagAllocation = allocation;
     UNRECOVERABLE_IF(allocation == nullptr);
@@ -583,4 +632,61 @@ bool CommandStreamReceiver::checkImplicitFlushForGpuIdle() {
     return false;
 }
 
+bool CommandStreamReceiver::checkImplicitFlushForAdaptiveDispatch(AdaptiveDispatchStatistics *queueStatistics) {
+    adaptiveBatchSize++;
+    if (adaptiveBatchSize == 1u) {
+        adaptiveBatchStartTime = std::chrono::high_resolution_clock::now();
+    }
+
+    if (checkAdaptiveDispatchLimits(queueStatistics)) {
+        return true;
+    }
+    countAdaptiveDispatchDecision(&AdaptiveDispatchStatistics::batchedSubmissions, queueStatistics);
+    return false;
+}
+
+bool CommandStreamReceiver::checkAdaptiveDispatchLimits(AdaptiveDispatchStatistics *queueStatistics) {
+    //GPU has nothing to execute, do not delay the work
+    if (tagAddress == nullptr || *tagAddress >= this->latestFlushedTaskCount) {
+        countAdaptiveDispatchDecision(&AdaptiveDispatchStatistics::idleFlushes, queueStatistics);
+        return true;
+    }
+    if (adaptiveBatchSize >= adaptiveDispatchMaxBatchSize) {
+        countAdaptiveDispatchDecision(&AdaptiveDispatchStatistics::batchSizeFlushes, queueStatistics);
+        return true;
+    }
+    auto batchAge = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::high_resolution_clock::now() - adaptiveBatchStartTime).count();
+    if (batchAge >= adaptiveDispatchMaxBatchAge) {
+        countAdaptiveDispatchDecision(&AdaptiveDispatchStatistics::batchAgeFlushes, queueStatistics);
+        return true;
+    }
+    return false;
+}
+
+void CommandStreamReceiver::countAdaptiveDispatchDecision(uint64_t AdaptiveDispatchStatistics::*decision, AdaptiveDispatchStatistics *queueStatistics) {
+    adaptiveDispatchStatistics.*decision += 1;
+    if (queueStatistics) {
+        queueStatistics->*decision += 1;
+    }
+}
+
+bool CommandStreamReceiver::flushAdaptiveBatchIfNeeded(uint32_t taskCountToWait, AdaptiveDispatchStatistics *queueStatistics) {
+    if (this->dispatchMode != DispatchMode::AdaptiveDispatch) {
+        return true;
+    }
+    auto lock = obtainUniqueOwnership();
+    if (adaptiveBatchSize == 0u) {
+        return true;
+    }
+    //waiting for batched work, it has to reach GPU regardless of batch limits
+    if (taskCountToWait > this->latestFlushedTaskCount) {
+        countAdaptiveDispatchDecision(&AdaptiveDispatchStatistics::waitFlushes, queueStatistics);
+        return this->flushBatchedSubmissions();
+    }
+    if (checkAdaptiveDispatchLimits(queueStatistics)) {
+        return this->flushBatchedSubmissions();
+    }
+    return true;
+}
+
 } // namespace NEO
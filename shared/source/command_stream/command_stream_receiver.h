@@ -11,6 +11,7 @@
 #include "shared/source/command_stream/linear_stream.h"
 #include "shared/source/command_stream/submissions_aggregator.h"
 #include "shared/source/command_stream/thread_arbitration_policy.h"
+#include "shared/source/direct_submission/submission_timeline.h"
 #include "shared/source/helpers/aligned_memory.h"
 #include "shared/source/helpers/blit_commands_helper.h"
 #include "shared/source/helpers/completion_stamp.h"
@@ -22,6 +23,7 @@
 
 #include "csr_properties_flags.h"
 
+#include <chrono>
 #include <cstddef>
 #include <cstdint>
 
@@ -50,7 +52,7 @@ class TagAllocator;
 enum class DispatchMode {
     DeviceDefault = 0,          //default for given device
     ImmediateDispatch,          //everything is submitted to the HW immediately
-    AdaptiveDispatch,           //dispatching is handled to async thread, which combines batch buffers basing on load (not implemented)
+    AdaptiveDispatch,           //dispatching is batched while GPU is busy, flushed when GPU is idle or batch limits are reached
     BatchedDispatchWithCounter, //dispatching is batched, after n commands there is implicit flush (not implemented)
     BatchedDispatch             // dispatching is batched, explicit clFlush is required
 };
@@ -108,6 +110,8 @@ class CommandStreamReceiver {
     }
     MOCKABLE_VIRTUAL volatile uint32_t *getTagAddress() const { return tagAddress; }
     uint64_t getDebugPauseStateGPUAddress() const { return tagAllocation->getGpuAddress() + debugPauseStateAddressOffset; }
+    uint64_t getCompletionTimestampGPUAddress(uint32_t taskCountToWrite) const { return tagAllocation->getGpuAddress() + getCompletionTimestampOffset(taskCountToWrite); }
+    void prepareCompletionTimestamp(Device &device, uint32_t taskCountToWrite);
 
     virtual bool waitForFlushStamp(FlushStamp &flushStampToWait) { return true; };
 
@@ -123,6 +127,8 @@ class CommandStreamReceiver {
     void enableNTo1SubmissionModel() { this->nTo1SubmissionModelEnabled = true; }
     bool isNTo1SubmissionModelEnabled() const { return this->nTo1SubmissionModelEnabled; }
     void overrideDispatchPolicy(DispatchMode overrideValue) { this->dispatchMode = overrideValue; }
+    const AdaptiveDispatchStatistics &getAdaptiveDispatchStatistics() const { return adaptiveDispatchStatistics; }
+    bool flushAdaptiveBatchIfNeeded(uint32_t taskCountToWait, AdaptiveDispatchStatistics *queueStatistics);
 
     void setMediaVFEStateDirty(bool dirty) { mediaVfeStateDirty = dirty; }
 
@@ -139,6 +145,9 @@ class CommandStreamReceiver {
     virtual void waitForTaskCountWithKmdNotifyFallback(uint32_t taskCountToWait, FlushStamp flushStampToWait, bool useQuickKmdSleep, bool forcePowerSavingMode) = 0;
     virtual bool waitForCompletionWithTimeout(bool enableTimeout, int64_t timeoutMicroseconds, uint32_t taskCountToWait);
     virtual void downloadAllocations(){};
+    virtual void downloadAllocationIfPending(GraphicsAllocation &gfxAllocation){};
+    //releases dispatches held back by direct submission, called whenever completion is queried
+    virtual void flushCoalescedSubmissions(){};
 
     void setSamplerCacheFlushRequired(SamplerCacheFlushState value) { this->samplerCacheFlushRequired = value; }
 
@@ -174,6 +183,7 @@ class CommandStreamReceiver {
     virtual size_t getPreferredTagPoolSize() const;
     virtual void setupContext(OsContext &osContext) { this->osContext = &osContext; }
     OsContext &getOsContext() const { return *osContext; }
+    OsContext *getOsContextPtr() const { return osContext; }
 
     TagAllocator<HwTimeStamps> *getEventTsAllocator();
     TagAllocator<HwPerfCounter> *getEventPerfCountAllocator(const uint32_t tagSize);
@@ -223,6 +233,13 @@ class CommandStreamReceiver {
     void printDeviceIndex();
     void checkForNewResources(uint32_t submittedTaskCount, uint32_t allocationTaskCount, GraphicsAllocation &gfxAllocation);
     bool checkImplicitFlushForGpuIdle();
+    bool checkImplicitFlushForAdaptiveDispatch(AdaptiveDispatchStatistics *queueStatistics);
+    bool checkAdaptiveDispatchLimits(AdaptiveDispatchStatistics *queueStatistics);
+    void countAdaptiveDispatchDecision(uint64_t AdaptiveDispatchStatistics::*decision, AdaptiveDispatchStatistics *queueStatistics);
+    void recordTagCompletion(uint32_t completedTaskCount);
+    static size_t getCompletionTimestampOffset(uint32_t taskCount) {
+        return completionTimestampsAddressOffset + (taskCount % completionTimestampsCount) * sizeof(uint64_t);
+    }
 
     std::unique_ptr<FlushStampTracker> flushStamp;
     std::unique_ptr<SubmissionAggregator> submissionAggregator;
@@ -248,6 +265,12 @@ class CommandStreamReceiver {
     // offset for debug state must be 8 bytes, if only 4 bytes are used tag writes overwrite it
     const uint64_t debugPauseStateAddressOffset = 8;
 
+    // GPU timestamps of tag writes for submission timeline, indexed by written task count
+    static constexpr size_t completionTimestampsAddressOffset = 64;
+    static constexpr uint32_t completionTimestampsCount = 64;
+    SubmissionTimelineClock timelineClock;
+    std::atomic<uint32_t> lastRecordedTagCompletion{0};
+
     static void *asyncDebugBreakConfirmation(void *arg);
     std::unique_ptr<Thread> userPauseConfirmation;
     std::function<void()> debugConfirmationFunction = []() { std::cin.get(); };
@@ -271,6 +294,12 @@ class CommandStreamReceiver {
     PreemptionMode lastPreemptionMode = PreemptionMode::Initial;
     uint64_t totalMemoryUsed = 0u;
 
+    AdaptiveDispatchStatistics adaptiveDispatchStatistics;
+    std::chrono::high_resolution_clock::time_point adaptiveBatchStartTime;
+    int64_t adaptiveDispatchMaxBatchAge = 500;
+    uint32_t adaptiveDispatchMaxBatchSize = 16u;
+    uint32_t adaptiveBatchSize = 0u;
+
     // taskCount - # of tasks submitted
     std::atomic<uint32_t> taskCount{0};
 
@@ -70,6 +70,8 @@ class CommandStreamReceiverHw : public CommandStreamReceiver {
     void adjustThreadArbitionPolicy(void *const stateComputeMode);
 
     void waitForTaskCountWithKmdNotifyFallback(uint32_t taskCountToWait, FlushStamp flushStampToWait, bool useQuickKmdSleep, bool forcePowerSavingMode) override;
+    bool waitForCompletionWithTimeout(bool enableTimeout, int64_t timeoutMicroseconds, uint32_t taskCountToWait) override;
+    void flushCoalescedSubmissions() override;
     const HardwareInfo &peekHwInfo() const;
 
     void collectStateBaseAddresPatchInfo(
@@ -13,6 +13,7 @@
 #include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/device/device.h"
 #include "shared/source/direct_submission/direct_submission_hw.h"
+#include "shared/source/direct_submission/submission_timeline.h"
 #include "shared/source/execution_environment/root_device_environment.h"
 #include "shared/source/gmm_helper/page_table_mngr.h"
 #include "shared/source/helpers/blit_commands_helper.h"
@@ -190,6 +191,9 @@ CompletionStamp CommandStreamReceiverHw<GfxFamily>::flushTask(
 
     DBG_LOG(LogTaskCounts, __FUNCTION__, "Line: ", __LINE__, "taskLevel", taskLevel);
 
+    SubmissionTimelineScope flushTaskScope(SubmissionTimelineEvent::FlushTask, osContext);
+    flushTaskScope.setValue(taskCount + 1);
+
     auto levelClosed = false;
     bool implicitFlush = dispatchFlags.implicitFlush || dispatchFlags.blocking || DebugManager.flags.ForceImplicitFlush.get();
     void *currentPipeControlForNooping = nullptr;
@@ -214,6 +218,19 @@ CompletionStamp CommandStreamReceiverHw<GfxFamily>::flushTask(
             }
         }
 
+        if (SubmissionTimeline::isEnabled()) {
+            //programmed before epilogue, which may be nooped in batched submissions
+            prepareCompletionTimestamp(device, taskCount + 1);
+            PipeControlArgs timestampArgs;
+            MemorySynchronizationCommands<GfxFamily>::addPipeControlAndProgramPostSyncOperation(
+                commandStreamTask,
+                PIPE_CONTROL::POST_SYNC_OPERATION_WRITE_TIMESTAMP,
+                getCompletionTimestampGPUAddress(taskCount + 1),
+                0llu,
+                peekHwInfo(),
+                timestampArgs);
+        }
+
         epiloguePipeControlLocation = ptrOffset(commandStreamTask.getCpuBase(), commandStreamTask.getUsed());
 
         if ((dispatchFlags.outOfOrderExecutionAllowed || timestampPacketWriteEnabled) &&
@@ -579,7 +596,12 @@ CompletionStamp CommandStreamReceiverHw<GfxFamily>::flushTask(
     }
     implicitFlush |= checkImplicitFlushForGpuIdle();
 
-    if (this->dispatchMode == DispatchMode::BatchedDispatch && implicitFlush) {
+    //count only decisions made by the policy, batch is flushed for other reasons otherwise
+    if (this->dispatchMode == DispatchMode::AdaptiveDispatch && (submitCSR | submitTask) && !implicitFlush) {
+        implicitFlush = checkImplicitFlushForAdaptiveDispatch(dispatchFlags.adaptiveDispatchStatistics);
+    }
+
+    if ((this->dispatchMode == DispatchMode::BatchedDispatch || this->dispatchMode == DispatchMode::AdaptiveDispatch) && implicitFlush) {
         this->flushBatchedSubmissions();
     }
 
@@ -723,6 +745,7 @@ inline bool CommandStreamReceiverHw<GfxFamily>::flushBatchedSubmissions() {
             resourcePackage.clear();
         }
         this->totalMemoryUsed = 0;
+        this->adaptiveBatchSize = 0u;
     }
 
     return submitResult;
@@ -751,6 +774,9 @@ size_t CommandStreamReceiverHw<GfxFamily>::getRequiredCmdStreamSize(const Dispat
     size += getCmdSizeForPreemption(dispatchFlags);
     size += getCmdSizeForEpilogue(dispatchFlags);
     size += getCmdsSizeForHardwareContext();
+    if (SubmissionTimeline::isEnabled()) {
+        size += MemorySynchronizationCommands<GfxFamily>::getSizeForPipeControlWithPostSyncOperation(peekHwInfo());
+    }
 
     if (executionEnvironment.rootDeviceEnvironments[rootDeviceIndex]->getHardwareInfo()->workaroundTable.waSamplerCacheFlushBetweenRedescribedSurfaceReads) {
         if (this->samplerCacheFlushRequired != SamplerCacheFlushState::samplerCacheFlushNotRequired) {
@@ -829,6 +855,30 @@ inline void CommandStreamReceiverHw<GfxFamily>::waitForTaskCountWithKmdNotifyFal
                        "\nWaiting completed. Current value: %u\n", *getTagAddress());
 }
 
+template <typename GfxFamily>
+bool CommandStreamReceiverHw<GfxFamily>::waitForCompletionWithTimeout(bool enableTimeout, int64_t timeoutMicroseconds, uint32_t taskCountToWait) {
+    flushCoalescedSubmissions();
+    return CommandStreamReceiver::waitForCompletionWithTimeout(enableTimeout, timeoutMicroseconds, taskCountToWait);
+}
+
+template <typename GfxFamily>
+void CommandStreamReceiverHw<GfxFamily>::flushCoalescedSubmissions() {
+    //polling of events and fences must not contend with submitting threads when nothing is held back
+    bool coalescedDispatchesPending = (directSubmission.get() && directSubmission->hasCoalescedDispatches()) ||
+                                      (blitterDirectSubmission.get() && blitterDirectSubmission->hasCoalescedDispatches());
+    if (!coalescedDispatchesPending) {
+        return;
+    }
+    //ring buffer and semaphore are shared with dispatches made under CSR ownership
+    auto lock = obtainUniqueOwnership();
+    if (directSubmission.get()) {
+        directSubmission->flushCoalescedDispatches();
+    }
+    if (blitterDirectSubmission.get()) {
+        blitterDirectSubmission->flushCoalescedDispatches();
+    }
+}
+
 template <typename GfxFamily>
 inline const HardwareInfo &CommandStreamReceiverHw<GfxFamily>::peekHwInfo() const {
     return *executionEnvironment.rootDeviceEnvironments[rootDeviceIndex]->getHardwareInfo();
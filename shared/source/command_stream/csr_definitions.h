@@ -21,6 +21,15 @@
 namespace NEO {
 struct FlushStampTrackingObj;
 
+//decisions made by adaptive dispatch policy, kept per command stream receiver and per queue
+struct AdaptiveDispatchStatistics {
+    uint64_t batchedSubmissions = 0u;
+    uint64_t idleFlushes = 0u;
+    uint64_t batchSizeFlushes = 0u;
+    uint64_t batchAgeFlushes = 0u;
+    uint64_t waitFlushes = 0u;
+};
+
 namespace CSRequirements {
 //cleanup section usually contains 1-2 pipeControls BB end and place for BB start
 //that makes 16 * 2 + 4 + 8 = 40 bytes
@@ -87,6 +96,7 @@ struct DispatchFlags {
     uint32_t additionalKernelExecInfo = AdditionalKernelExecInfo::NotApplicable;
     uint64_t sliceCount = QueueSliceCount::defaultSliceCount;
     uint64_t engineHints = 0;
+    AdaptiveDispatchStatistics *adaptiveDispatchStatistics = nullptr;
     bool blocking = false;
     bool dcFlush = false;
     bool useSLM = false;
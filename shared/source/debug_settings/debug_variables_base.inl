@@ -131,6 +131,17 @@ DECLARE_DEBUG_VARIABLE(int32_t, MinHwThreadsUnoccupied, 0, "If not zero then max
 DECLARE_DEBUG_VARIABLE(int32_t, PerformImplicitFlushEveryEnqueueCount, -1, "If greater then 0, driver performs implicit flush every N submissions.")
 DECLARE_DEBUG_VARIABLE(int32_t, PerformImplicitFlushForNewResource, -1, "-1: platform specific, 0: force disable, 1: force enable")
 DECLARE_DEBUG_VARIABLE(int32_t, PerformImplicitFlushForIdleGpu, -1, "-1: platform specific, 0: force disable, 1: force enable")
+DECLARE_DEBUG_VARIABLE(int32_t, L0CommandQueueMaxCommandBuffers, -1, "-1: default (8), >=2: maximum number of command buffers a Level Zero command queue allocates before waiting for GPU to retire the oldest one")
+DECLARE_DEBUG_VARIABLE(bool, EnableCommandQueueSubmissionReplay, false, "Replay cached queue commands and residency when the same set of closed command lists is executed again")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableSplitMemoryCopy, -1, "-1: default (disabled), 0: disabled, 1: immediate compute command lists split large memory copies between copy engine and compute copy kernel")
+DECLARE_DEBUG_VARIABLE(int32_t, SplitMemoryCopyMinSize, -1, "-1: default (64MB), >=0: minimal size in bytes of a memory copy split between copy engine and compute")
+DECLARE_DEBUG_VARIABLE(int32_t, SplitMemoryCopyCopyEngineBandwidth, -1, "-1: default, >0: copy engine bandwidth in MB/s used to partition split memory copies")
+DECLARE_DEBUG_VARIABLE(int32_t, SplitMemoryCopyComputeBandwidth, -1, "-1: default, >0: compute copy kernel bandwidth in MB/s used to partition split memory copies")
+DECLARE_DEBUG_VARIABLE(bool, EnableDispatchStateReuse, false, "Consecutive kernel dispatches with identical state reuse interface descriptor and binding table of the previous dispatch")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableBarrierElision, -1, "-1: default, barriers between independent kernels are elided on command lists created with relaxed ordering, 0: disabled, 1: enabled on all regular command lists, 2: validation, barriers are programmed as usual and elision decisions are checked against conservative dependency tracking")
+DECLARE_DEBUG_VARIABLE(bool, EnableLazyKernelInitialization, false, "Module creation only describes kernels; ISA allocation and kernel data templates are created when a kernel is first created")
+DECLARE_DEBUG_VARIABLE(bool, EnableSharedIsaPool, false, "Kernel ISA of L0 modules is packed into per-device pool allocations instead of a dedicated allocation per kernel")
+DECLARE_DEBUG_VARIABLE(int32_t, SharedIsaPoolSize, -1, "-1: default (2MB), >0: size in bytes of each kernel ISA pool")
 
 /*DIRECT SUBMISSION FLAGS*/
 DECLARE_DEBUG_VARIABLE(int32_t, EnableDirectSubmission, -1, "-1: default (disabled), 0: disable, 1:enable. Enables direct submission of command buffers bypassing KMD")
@@ -145,8 +156,14 @@ DECLARE_DEBUG_VARIABLE(int32_t, DirectSubmissionOverrideBlitterSupport, -1, "Ove
 DECLARE_DEBUG_VARIABLE(int32_t, DirectSubmissionOverrideRenderSupport, -1, "Overrides default render support: -1: do not override, 0: disable engine support, 1: enable engine support with init start, 2: enable engine support without init start")
 DECLARE_DEBUG_VARIABLE(int32_t, DirectSubmissionOverrideComputeSupport, -1, "Overrides default compute support: -1: do not override, 0: disable engine support, 1: enable engine support with init start, 2: enable engine support without init start")
 DECLARE_DEBUG_VARIABLE(int32_t, DirectSubmissionDisableCacheFlush, -1, "-1: driver default, 0: additional cache flush is present 1: disable dispatching cache flush commands")
+DECLARE_DEBUG_VARIABLE(int32_t, DirectSubmissionCoalesceDispatchCount, -1, "-1: default (disabled), >1: number of batch buffers chained in ring buffer before single semaphore release")
+DECLARE_DEBUG_VARIABLE(int32_t, DirectSubmissionMaxRingBuffers, -1, "-1: default (8), >=2: maximum number of ring buffers allocated when GPU has not retired previous ones")
+DECLARE_DEBUG_VARIABLE(int32_t, DirectSubmissionCoalesceLatencyBudget, -1, "-1: default (no time limit), >=0: time in microseconds after which coalesced batch buffers are released, checked only on next dispatch, wait or event and fence poll, so it is not enforced while the application is idle")
 DECLARE_DEBUG_VARIABLE(bool, USMEvictAfterMigration, true, "Evict USM allocation after implicit migration to GPU")
 DECLARE_DEBUG_VARIABLE(bool, DirectSubmissionDisableMonitorFence, false, "Disable dispatching monitor fence commands")
+DECLARE_DEBUG_VARIABLE(bool, EnableSubmissionTimeline, false, "Record enqueue, flushTask, ring dispatch, semaphore release and tag completion events per engine")
+DECLARE_DEBUG_VARIABLE(int32_t, SubmissionTimelineBufferSize, 4096, "Number of submission timeline events kept per thread, older events are overwritten")
+DECLARE_DEBUG_VARIABLE(std::string, SubmissionTimelineExportFile, std::string("unk"), "File name where submission timeline is stored as Chrome trace JSON at process exit")
 
 /*FEATURE FLAGS*/
 DECLARE_DEBUG_VARIABLE(bool, EnableNV12, true, "Enables NV12 extension")
@@ -185,6 +202,8 @@ DECLARE_DEBUG_VARIABLE(int32_t, OverrideEnableQuickKmdSleepForSporadicWaits, -1,
 DECLARE_DEBUG_VARIABLE(int32_t, OverrideDelayQuickKmdSleepForSporadicWaitsMicroseconds, -1, "-1: dont override, >0: timeout in microseconds")
 DECLARE_DEBUG_VARIABLE(int32_t, PowerSavingMode, 0, "0: default 1: enable. Whenever driver waits on GPU and its not ready, put waiting thread to sleep and wait for notification.")
 DECLARE_DEBUG_VARIABLE(int32_t, CsrDispatchMode, 0, "Chooses DispatchMode for Csr")
+DECLARE_DEBUG_VARIABLE(int32_t, CsrAdaptiveDispatchMaxBatchSize, -1, "-1: default (16), >0: in adaptive dispatch mode flush after given number of batched submissions")
+DECLARE_DEBUG_VARIABLE(int32_t, CsrAdaptiveDispatchMaxBatchAge, -1, "-1: default (500), >=0: in adaptive dispatch mode flush when oldest batched submission is older than given number of microseconds")
 DECLARE_DEBUG_VARIABLE(int32_t, RenderCompressedImagesEnabled, -1, "-1: default, 0: disabled, 1: enabled")
 DECLARE_DEBUG_VARIABLE(int32_t, RenderCompressedBuffersEnabled, -1, "-1: default, 0: disabled, 1: enabled")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableSharedSystemUsmSupport, -1, "-1: default, 0: shared system memory disabled, 1: shared system memory enabled")
@@ -194,6 +213,7 @@ DECLARE_DEBUG_VARIABLE(int32_t, ForceDeviceEnqueueSupport, -1, "-1: default, 0:
 DECLARE_DEBUG_VARIABLE(int32_t, ForcePipeSupport, -1, "-1: default, 0: disabled, 1: enabled")
 DECLARE_DEBUG_VARIABLE(int32_t, UseAsyncDrmExec, -1, "-1: default, 0: Disabled 1: Enabled. If enabled, pass EXEC_OBJECT_ASYNC to exec ioctl.")
 DECLARE_DEBUG_VARIABLE(int32_t, UseBindlessMode, -1, "Use precompiled builtins in bindless mode, -1: api dependent, 0: disabled, 1: enabled")
+DECLARE_DEBUG_VARIABLE(int32_t, SysmanTelemetrySamplingPeriod, -1, "-1: default (disabled), >0: period in milliseconds at which a background thread samples sysman energy counters and engine activity, queries return the latest sample")
 
 /*DRIVER TOGGLES*/
 DECLARE_DEBUG_VARIABLE(int32_t, ForceOCLVersion, 0, "Force specific OpenCL API version")
@@ -13,6 +13,7 @@
 #include "shared/source/execution_environment/root_device_environment.h"
 #include "shared/source/gmm_helper/gmm_helper.h"
 #include "shared/source/helpers/hw_helper.h"
+#include "shared/source/memory_manager/isa_pool_allocator.h"
 #include "shared/source/memory_manager/memory_manager.h"
 #include "shared/source/os_interface/driver_info.h"
 #include "shared/source/os_interface/os_context.h"
@@ -28,6 +29,7 @@ extern CommandStreamReceiver *createCommandStream(ExecutionEnvironment &executio
 Device::Device(ExecutionEnvironment *executionEnvironment)
     : executionEnvironment(executionEnvironment) {
     this->executionEnvironment->incRefInternal();
+    isaPoolAllocator = std::make_unique<IsaPoolAllocator>(*this);
 }
 
 Device::~Device() {
@@ -40,6 +42,7 @@ Device::~Device() {
         engine.commandStreamReceiver->flushBatchedSubmissions();
     }
 
+    isaPoolAllocator.reset();
     commandStreamReceivers.clear();
     executionEnvironment->memoryManager->waitForDeletions();
     executionEnvironment->decRefInternal();
@@ -18,6 +18,7 @@
 #include "opencl/source/os_interface/performance_counters.h"
 
 namespace NEO {
+class IsaPoolAllocator;
 class OSTime;
 class SourceLevelDebugger;
 
@@ -87,6 +88,7 @@ class Device : public ReferenceTrackedObject<Device> {
     }
     MOCKABLE_VIRTUAL CompilerInterface *getCompilerInterface() const;
     BuiltIns *getBuiltIns() const;
+    IsaPoolAllocator *getIsaPoolAllocator() const { return isaPoolAllocator.get(); }
 
     virtual uint32_t getRootDeviceIndex() const = 0;
     virtual uint32_t getNumAvailableDevices() const = 0;
@@ -122,6 +124,7 @@ class Device : public ReferenceTrackedObject<Device> {
     HardwareCapabilities hardwareCapabilities = {};
     std::unique_ptr<OSTime> osTime;
     std::unique_ptr<PerformanceCounters> performanceCounters;
+    std::unique_ptr<IsaPoolAllocator> isaPoolAllocator;
     std::vector<std::unique_ptr<CommandStreamReceiver>> commandStreamReceivers;
     std::vector<EngineControl> engines;
     std::vector<std::vector<EngineControl>> engineGroups;
@@ -11,7 +11,10 @@
 #include "shared/source/helpers/constants.h"
 #include "shared/source/utilities/stackvec.h"
 
+#include <atomic>
+#include <chrono>
 #include <memory>
+#include <vector>
 
 namespace NEO {
 
@@ -36,9 +39,17 @@ struct TagData {
     uint64_t tagValue = 0ull;
 };
 
+struct RingBufferStatistics {
+    uint64_t switches = 0u;
+    uint64_t stalls = 0u;
+    uint64_t allocations = 0u;
+    uint64_t releases = 0u;
+};
+
 namespace UllsDefaults {
 constexpr bool defaultDisableCacheFlush = true;
 constexpr bool defaultDisableMonitorFence = false;
+constexpr uint32_t defaultMaxRingBufferCount = 8u;
 } // namespace UllsDefaults
 
 struct BatchBuffer;
@@ -65,12 +76,29 @@ class DirectSubmissionHw {
 
     bool dispatchCommandBuffer(BatchBuffer &batchBuffer, FlushStampTracker &flushStamp);
 
+    void flushCoalescedDispatches();
+
+    //may be called without CSR ownership, to skip taking it when nothing is held back
+    bool hasCoalescedDispatches() const {
+        return coalescedDispatches.load(std::memory_order_acquire) != 0u;
+    }
+
     static std::unique_ptr<DirectSubmissionHw<GfxFamily, Dispatcher>> create(Device &device, OsContext &osContext);
 
+    const RingBufferStatistics &getRingBufferStatistics() const {
+        return ringBufferStatistics;
+    }
+
+    size_t getRingBufferCount() const {
+        return ringBuffers.size();
+    }
+
   protected:
     static constexpr size_t prefetchSize = 8 * MemoryConstants::cacheLineSize;
     static constexpr size_t prefetchNoops = prefetchSize / sizeof(uint32_t);
+    static constexpr size_t ringBufferSize = 256 * MemoryConstants::kiloByte;
     bool allocateResources();
+    GraphicsAllocation *allocateRingBuffer();
     void deallocateResources();
     MOCKABLE_VIRTUAL bool makeResourcesResident(DirectSubmissionAllocations &allocations);
     virtual bool allocateOsResources() = 0;
@@ -79,6 +107,8 @@ class DirectSubmissionHw {
     virtual uint64_t switchRingBuffers();
     virtual void handleSwitchRingBuffers() = 0;
     GraphicsAllocation *switchRingBuffersAllocations();
+    void releaseIdleRingBuffers(uint32_t previousRingBuffer);
+    virtual bool isCompleted(uint32_t ringBufferIndex) = 0;
     virtual uint64_t updateTagValue() = 0;
     virtual void getTagAddressValue(TagData &tagData) = 0;
 
@@ -96,8 +126,12 @@ class DirectSubmissionHw {
     void setReturnAddress(void *returnCmd, uint64_t returnAddress);
 
     void *dispatchWorkloadSection(BatchBuffer &batchBuffer);
+    void *dispatchWorkloadCommands(BatchBuffer &batchBuffer);
     size_t getSizeDispatch();
 
+    bool isCoalescingActive() const;
+    bool isCoalescingBudgetExceeded() const;
+
     void dispatchPrefetchMitigation();
     size_t getSizePrefetchMitigation();
 
@@ -114,32 +148,43 @@ class DirectSubmissionHw {
     void dispatchDiagnosticModeSection();
     size_t getDiagnosticModeSection();
 
-    enum RingBufferUse : uint32_t {
-        FirstBuffer,
-        SecondBuffer,
-        MaxBuffers
+    struct RingBufferUse {
+        RingBufferUse() = default;
+        RingBufferUse(FlushStamp completionFence, GraphicsAllocation *ringBuffer) : completionFence(completionFence), ringBuffer(ringBuffer){};
+
+        static constexpr uint32_t initialRingBufferCount = 2u;
+
+        FlushStamp completionFence = 0ull;
+        GraphicsAllocation *ringBuffer = nullptr;
     };
+    using RingBufferContainer = std::vector<RingBufferUse>;
 
     LinearStream ringCommandStream;
-    FlushStamp completionRingBuffers[RingBufferUse::MaxBuffers] = {0ull, 0ull};
+    RingBufferContainer ringBuffers;
+    RingBufferStatistics ringBufferStatistics;
     std::unique_ptr<DirectSubmissionDiagnosticsCollector> diagnostic;
+    std::chrono::high_resolution_clock::time_point coalesceStartTime;
 
     uint64_t semaphoreGpuVa = 0u;
 
     Device &device;
     OsContext &osContext;
     const HardwareInfo *hwInfo = nullptr;
-    GraphicsAllocation *ringBuffer = nullptr;
-    GraphicsAllocation *ringBuffer2 = nullptr;
     GraphicsAllocation *semaphores = nullptr;
     void *semaphorePtr = nullptr;
     volatile RingSemaphoreData *semaphoreData = nullptr;
     volatile void *workloadModeOneStoreAddress = nullptr;
+    void *coalesceStartPosition = nullptr;
+
+    int64_t coalesceLatencyBudget = -1;
 
     uint32_t currentQueueWorkCount = 1u;
-    RingBufferUse currentRingBuffer = RingBufferUse::FirstBuffer;
+    uint32_t currentRingBuffer = 0u;
+    uint32_t maxRingBufferCount = UllsDefaults::defaultMaxRingBufferCount;
     uint32_t workloadMode = 0;
     uint32_t workloadModeOneExpectedValue = 0u;
+    uint32_t coalesceMaxDispatches = 0u;
+    std::atomic<uint32_t> coalescedDispatches{0u};
 
     bool ringStart = false;
     bool disableCpuCacheFlush = true;
@@ -11,6 +11,7 @@
 #include "shared/source/device/device.h"
 #include "shared/source/direct_submission/direct_submission_hw.h"
 #include "shared/source/direct_submission/direct_submission_hw_diagnostic_mode.h"
+#include "shared/source/direct_submission/submission_timeline.h"
 #include "shared/source/helpers/flush_stamp.h"
 #include "shared/source/helpers/ptr_math.h"
 #include "shared/source/memory_manager/allocation_properties.h"
@@ -21,6 +22,7 @@
 #include "shared/source/utilities/cpu_info.h"
 #include "shared/source/utilities/cpuintrinsics.h"
 
+#include <algorithm>
 #include <cstring>
 
 namespace NEO {
@@ -42,6 +44,15 @@ DirectSubmissionHw<GfxFamily, Dispatcher>::DirectSubmissionHw(Device &device,
     if (disableCacheFlushKey != -1) {
         disableCpuCacheFlush = disableCacheFlushKey == 1 ? true : false;
     }
+
+    if (DebugManager.flags.DirectSubmissionCoalesceDispatchCount.get() > 1) {
+        coalesceMaxDispatches = static_cast<uint32_t>(DebugManager.flags.DirectSubmissionCoalesceDispatchCount.get());
+    }
+    coalesceLatencyBudget = DebugManager.flags.DirectSubmissionCoalesceLatencyBudget.get();
+    if (DebugManager.flags.DirectSubmissionMaxRingBuffers.get() != -1) {
+        maxRingBufferCount = std::max(static_cast<uint32_t>(DebugManager.flags.DirectSubmissionMaxRingBuffers.get()),
+                                      RingBufferUse::initialRingBufferCount);
+    }
     hwInfo = &device.getHardwareInfo();
     createDiagnostic();
 }
@@ -50,25 +61,35 @@ template <typename GfxFamily, typename Dispatcher>
 DirectSubmissionHw<GfxFamily, Dispatcher>::~DirectSubmissionHw() = default;
 
 template <typename GfxFamily, typename Dispatcher>
-bool DirectSubmissionHw<GfxFamily, Dispatcher>::allocateResources() {
-    DirectSubmissionAllocations allocations;
-
+GraphicsAllocation *DirectSubmissionHw<GfxFamily, Dispatcher>::allocateRingBuffer() {
     bool isMultiOsContextCapable = osContext.getNumSupportedDevices() > 1u;
     MemoryManager *memoryManager = device.getExecutionEnvironment()->memoryManager.get();
-    constexpr size_t minimumRequiredSize = 256 * MemoryConstants::kiloByte;
     constexpr size_t additionalAllocationSize = MemoryConstants::pageSize;
-    const auto allocationSize = alignUp(minimumRequiredSize + additionalAllocationSize, MemoryConstants::pageSize64k);
+    const auto allocationSize = alignUp(ringBufferSize + additionalAllocationSize, MemoryConstants::pageSize64k);
     const AllocationProperties commandStreamAllocationProperties{device.getRootDeviceIndex(),
                                                                  true, allocationSize,
                                                                  GraphicsAllocation::AllocationType::RING_BUFFER,
                                                                  isMultiOsContextCapable, osContext.getDeviceBitfield()};
-    ringBuffer = memoryManager->allocateGraphicsMemoryWithProperties(commandStreamAllocationProperties);
-    UNRECOVERABLE_IF(ringBuffer == nullptr);
-    allocations.push_back(ringBuffer);
+    GraphicsAllocation *allocation = memoryManager->allocateGraphicsMemoryWithProperties(commandStreamAllocationProperties);
+    if (allocation != nullptr) {
+        memset(allocation->getUnderlyingBuffer(), 0, allocationSize);
+    }
+    return allocation;
+}
+
+template <typename GfxFamily, typename Dispatcher>
+bool DirectSubmissionHw<GfxFamily, Dispatcher>::allocateResources() {
+    DirectSubmissionAllocations allocations;
 
-    ringBuffer2 = memoryManager->allocateGraphicsMemoryWithProperties(commandStreamAllocationProperties);
-    UNRECOVERABLE_IF(ringBuffer2 == nullptr);
-    allocations.push_back(ringBuffer2);
+    bool isMultiOsContextCapable = osContext.getNumSupportedDevices() > 1u;
+    MemoryManager *memoryManager = device.getExecutionEnvironment()->memoryManager.get();
+
+    for (uint32_t ringBufferIndex = 0; ringBufferIndex < RingBufferUse::initialRingBufferCount; ringBufferIndex++) {
+        GraphicsAllocation *ringBuffer = allocateRingBuffer();
+        UNRECOVERABLE_IF(ringBuffer == nullptr);
+        ringBuffers.emplace_back(0ull, ringBuffer);
+        allocations.push_back(ringBuffer);
+    }
 
     const AllocationProperties semaphoreAllocationProperties{device.getRootDeviceIndex(),
                                                              true, MemoryConstants::pageSize,
@@ -79,11 +100,10 @@ bool DirectSubmissionHw<GfxFamily, Dispatcher>::allocateResources() {
     allocations.push_back(semaphores);
 
     handleResidency();
-    ringCommandStream.replaceBuffer(ringBuffer->getUnderlyingBuffer(), minimumRequiredSize);
-    ringCommandStream.replaceGraphicsAllocation(ringBuffer);
+    currentRingBuffer = 0u;
+    ringCommandStream.replaceBuffer(ringBuffers[currentRingBuffer].ringBuffer->getUnderlyingBuffer(), ringBufferSize);
+    ringCommandStream.replaceGraphicsAllocation(ringBuffers[currentRingBuffer].ringBuffer);
 
-    memset(ringBuffer->getUnderlyingBuffer(), 0, allocationSize);
-    memset(ringBuffer2->getUnderlyingBuffer(), 0, allocationSize);
     semaphorePtr = semaphores->getUnderlyingBuffer();
     semaphoreGpuVa = semaphores->getGpuAddress();
     semaphoreData = static_cast<volatile RingSemaphoreData *>(semaphorePtr);
@@ -169,6 +189,8 @@ bool DirectSubmissionHw<GfxFamily, Dispatcher>::startRingBuffer() {
 
 template <typename GfxFamily, typename Dispatcher>
 bool DirectSubmissionHw<GfxFamily, Dispatcher>::stopRingBuffer() {
+    flushCoalescedDispatches();
+
     void *flushPtr = ringCommandStream.getSpace(0);
     Dispatcher::dispatchCacheFlush(ringCommandStream, *hwInfo);
     if (disableMonitorFence) {
@@ -282,6 +304,13 @@ inline size_t DirectSubmissionHw<GfxFamily, Dispatcher>::getSizePrefetchMitigati
 
 template <typename GfxFamily, typename Dispatcher>
 void *DirectSubmissionHw<GfxFamily, Dispatcher>::dispatchWorkloadSection(BatchBuffer &batchBuffer) {
+    void *currentPosition = dispatchWorkloadCommands(batchBuffer);
+    dispatchSemaphoreSection(currentQueueWorkCount + 1);
+    return currentPosition;
+}
+
+template <typename GfxFamily, typename Dispatcher>
+void *DirectSubmissionHw<GfxFamily, Dispatcher>::dispatchWorkloadCommands(BatchBuffer &batchBuffer) {
     void *currentPosition = ringCommandStream.getSpace(0);
 
     if (workloadMode == 0) {
@@ -308,7 +337,6 @@ void *DirectSubmissionHw<GfxFamily, Dispatcher>::dispatchWorkloadSection(BatchBu
         Dispatcher::dispatchMonitorFence(ringCommandStream, currentTagData.tagAddress, currentTagData.tagValue, *hwInfo);
     }
 
-    dispatchSemaphoreSection(currentQueueWorkCount + 1);
     return currentPosition;
 }
 
@@ -317,6 +345,9 @@ bool DirectSubmissionHw<GfxFamily, Dispatcher>::dispatchCommandBuffer(BatchBuffe
     //for now workloads requiring cache coherency are not supported
     UNRECOVERABLE_IF(batchBuffer.requiresCoherency);
 
+    SubmissionTimelineScope dispatchScope(SubmissionTimelineEvent::RingDispatch, &osContext);
+    dispatchScope.setValue(currentQueueWorkCount);
+
     size_t dispatchSize = getSizeDispatch();
     size_t cycleSize = getSizeSwitchRingBufferSection();
     size_t requiredMinimalSize = dispatchSize + cycleSize + getSizeEnd();
@@ -325,10 +356,30 @@ bool DirectSubmissionHw<GfxFamily, Dispatcher>::dispatchCommandBuffer(BatchBuffe
     uint64_t startGpuVa = getCommandBufferPositionGpuAddress(ringCommandStream.getSpace(0));
 
     if (ringCommandStream.getAvailableSpace() < requiredMinimalSize) {
+        //coalesced workloads must be released before GPU is redirected to the next ring
+        flushCoalescedDispatches();
         startGpuVa = switchRingBuffers();
         buffersSwitched = true;
     }
 
+    if (isCoalescingActive()) {
+        void *currentPosition = dispatchWorkloadCommands(batchBuffer);
+        if (coalescedDispatches == 0u) {
+            coalesceStartPosition = currentPosition;
+            coalesceStartTime = std::chrono::high_resolution_clock::now();
+        }
+        coalescedDispatches++;
+        handleResidency();
+
+        uint64_t flushValue = updateTagValue();
+        flushStamp.setStamp(flushValue);
+
+        if (coalescedDispatches >= coalesceMaxDispatches || isCoalescingBudgetExceeded()) {
+            flushCoalescedDispatches();
+        }
+        return ringStart;
+    }
+
     void *currentPosition = dispatchWorkloadSection(batchBuffer);
 
     if (ringStart) {
@@ -339,6 +390,7 @@ bool DirectSubmissionHw<GfxFamily, Dispatcher>::dispatchCommandBuffer(BatchBuffe
     //unblock GPU
     semaphoreData->QueueWorkCount = currentQueueWorkCount;
     cpuCachelineFlush(semaphorePtr, MemoryConstants::cacheLineSize);
+    SubmissionTimelineRecorder::recordInstant(SubmissionTimelineEvent::SemaphoreRelease, &osContext, currentQueueWorkCount);
     currentQueueWorkCount++;
     DirectSubmissionDiagnostics::diagnosticModeOneSubmit(diagnostic.get());
     //when ring buffer is not started at init or being restarted
@@ -355,6 +407,39 @@ bool DirectSubmissionHw<GfxFamily, Dispatcher>::dispatchCommandBuffer(BatchBuffe
     return ringStart;
 }
 
+template <typename GfxFamily, typename Dispatcher>
+void DirectSubmissionHw<GfxFamily, Dispatcher>::flushCoalescedDispatches() {
+    if (coalescedDispatches == 0u) {
+        return;
+    }
+    dispatchSemaphoreSection(currentQueueWorkCount + 1);
+    cpuCachelineFlush(coalesceStartPosition, ptrDiff(ringCommandStream.getSpace(0), coalesceStartPosition));
+
+    //unblock GPU once for all chained workloads
+    semaphoreData->QueueWorkCount = currentQueueWorkCount;
+    cpuCachelineFlush(semaphorePtr, MemoryConstants::cacheLineSize);
+    SubmissionTimelineRecorder::recordInstant(SubmissionTimelineEvent::SemaphoreRelease, &osContext, currentQueueWorkCount);
+    currentQueueWorkCount++;
+
+    coalescedDispatches = 0u;
+    coalesceStartPosition = nullptr;
+}
+
+template <typename GfxFamily, typename Dispatcher>
+inline bool DirectSubmissionHw<GfxFamily, Dispatcher>::isCoalescingActive() const {
+    //diagnostic mode waits for each workload separately, so it cannot be coalesced
+    return coalesceMaxDispatches > 1u && ringStart && workloadMode == 0;
+}
+
+template <typename GfxFamily, typename Dispatcher>
+inline bool DirectSubmissionHw<GfxFamily, Dispatcher>::isCoalescingBudgetExceeded() const {
+    if (coalesceLatencyBudget < 0) {
+        return false;
+    }
+    auto delta = std::chrono::high_resolution_clock::now() - coalesceStartTime;
+    return std::chrono::duration_cast<std::chrono::microseconds>(delta).count() >= coalesceLatencyBudget;
+}
+
 template <typename GfxFamily, typename Dispatcher>
 inline void DirectSubmissionHw<GfxFamily, Dispatcher>::setReturnAddress(void *returnCmd, uint64_t returnAddress) {
     using MI_BATCH_BUFFER_START = typename GfxFamily::MI_BATCH_BUFFER_START;
@@ -397,29 +482,82 @@ inline uint64_t DirectSubmissionHw<GfxFamily, Dispatcher>::switchRingBuffers() {
 
 template <typename GfxFamily, typename Dispatcher>
 inline GraphicsAllocation *DirectSubmissionHw<GfxFamily, Dispatcher>::switchRingBuffersAllocations() {
-    GraphicsAllocation *nextAllocation = nullptr;
-    if (currentRingBuffer == RingBufferUse::FirstBuffer) {
-        nextAllocation = ringBuffer2;
-        currentRingBuffer = RingBufferUse::SecondBuffer;
-    } else {
-        nextAllocation = ringBuffer;
-        currentRingBuffer = RingBufferUse::FirstBuffer;
+    ringBufferStatistics.switches++;
+    uint32_t previousRingBuffer = currentRingBuffer;
+    uint32_t ringBufferCount = static_cast<uint32_t>(ringBuffers.size());
+
+    //reuse any ring buffer already retired by GPU before growing the pool
+    for (uint32_t offset = 1u; offset < ringBufferCount; offset++) {
+        uint32_t ringBufferIndex = (previousRingBuffer + offset) % ringBufferCount;
+        if (isCompleted(ringBufferIndex)) {
+            currentRingBuffer = ringBufferIndex;
+            releaseIdleRingBuffers(previousRingBuffer);
+            return ringBuffers[currentRingBuffer].ringBuffer;
+        }
+    }
+
+    if (ringBufferCount < maxRingBufferCount) {
+        GraphicsAllocation *nextAllocation = allocateRingBuffer();
+        if (nextAllocation != nullptr) {
+            DirectSubmissionAllocations allocations;
+            allocations.push_back(nextAllocation);
+            if (makeResourcesResident(allocations)) {
+                ringBuffers.emplace_back(0ull, nextAllocation);
+                currentRingBuffer = ringBufferCount;
+                ringBufferStatistics.allocations++;
+                return nextAllocation;
+            }
+            device.getExecutionEnvironment()->memoryManager->freeGraphicsMemory(nextAllocation);
+        }
+    }
+
+    //all ring buffers are in use, switch has to wait for GPU to leave the next one
+    ringBufferStatistics.stalls++;
+    currentRingBuffer = (previousRingBuffer + 1) % ringBufferCount;
+    return ringBuffers[currentRingBuffer].ringBuffer;
+}
+
+template <typename GfxFamily, typename Dispatcher>
+void DirectSubmissionHw<GfxFamily, Dispatcher>::releaseIdleRingBuffers(uint32_t previousRingBuffer) {
+    if (ringBuffers.size() <= RingBufferUse::initialRingBufferCount) {
+        return;
+    }
+
+    uint32_t idleRingBuffers = 0u;
+    uint32_t releaseCandidate = 0u;
+    for (uint32_t ringBufferIndex = 0; ringBufferIndex < ringBuffers.size(); ringBufferIndex++) {
+        if (ringBufferIndex == currentRingBuffer || ringBufferIndex == previousRingBuffer) {
+            continue;
+        }
+        if (isCompleted(ringBufferIndex)) {
+            idleRingBuffers++;
+            if (ringBufferIndex >= RingBufferUse::initialRingBufferCount) {
+                releaseCandidate = ringBufferIndex;
+            }
+        }
+    }
+
+    //keep one idle ring buffer as a spare for the next burst
+    if (idleRingBuffers > 1u && releaseCandidate != 0u) {
+        device.getExecutionEnvironment()->memoryManager->freeGraphicsMemory(ringBuffers[releaseCandidate].ringBuffer);
+        ringBuffers.erase(ringBuffers.begin() + releaseCandidate);
+        if (releaseCandidate < currentRingBuffer) {
+            currentRingBuffer--;
+        }
+        ringBufferStatistics.releases++;
     }
-    return nextAllocation;
 }
 
 template <typename GfxFamily, typename Dispatcher>
 void DirectSubmissionHw<GfxFamily, Dispatcher>::deallocateResources() {
     MemoryManager *memoryManager = device.getExecutionEnvironment()->memoryManager.get();
 
-    if (ringBuffer) {
-        memoryManager->freeGraphicsMemory(ringBuffer);
-        ringBuffer = nullptr;
-    }
-    if (ringBuffer2) {
-        memoryManager->freeGraphicsMemory(ringBuffer2);
-        ringBuffer2 = nullptr;
+    for (auto &ringBufferUse : ringBuffers) {
+        if (ringBufferUse.ringBuffer) {
+            memoryManager->freeGraphicsMemory(ringBufferUse.ringBuffer);
+        }
     }
+    ringBuffers.clear();
     if (semaphores) {
         memoryManager->freeGraphicsMemory(semaphores);
         semaphores = nullptr;
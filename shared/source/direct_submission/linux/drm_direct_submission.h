@@ -27,6 +27,7 @@ class DrmDirectSubmission : public DirectSubmissionHw<GfxFamily, Dispatcher> {
 
     bool handleResidency() override;
     void handleSwitchRingBuffers() override;
+    bool isCompleted(uint32_t ringBufferIndex) override;
     uint64_t updateTagValue() override;
     void getTagAddressValue(TagData &tagData) override;
 
@@ -29,9 +29,10 @@ DrmDirectSubmission<GfxFamily, Dispatcher>::DrmDirectSubmission(Device &device,
 template <typename GfxFamily, typename Dispatcher>
 inline DrmDirectSubmission<GfxFamily, Dispatcher>::~DrmDirectSubmission() {
     if (this->ringStart) {
+        this->flushCoalescedDispatches();
         this->wait(static_cast<uint32_t>(this->currentTagData.tagValue));
         this->stopRingBuffer();
-        auto bb = static_cast<DrmAllocation *>(this->ringBuffer)->getBO();
+        auto bb = static_cast<DrmAllocation *>(this->ringBuffers[0].ringBuffer)->getBO();
         bb->wait(-1);
     }
     this->deallocateResources();
@@ -84,16 +85,22 @@ bool DrmDirectSubmission<GfxFamily, Dispatcher>::handleResidency() {
 template <typename GfxFamily, typename Dispatcher>
 void DrmDirectSubmission<GfxFamily, Dispatcher>::handleSwitchRingBuffers() {
     if (this->ringStart) {
-        if (this->completionRingBuffers[this->currentRingBuffer] != 0) {
-            this->wait(static_cast<uint32_t>(this->completionRingBuffers[this->currentRingBuffer]));
+        if (this->ringBuffers[this->currentRingBuffer].completionFence != 0) {
+            this->wait(static_cast<uint32_t>(this->ringBuffers[this->currentRingBuffer].completionFence));
         }
     }
 }
 
+template <typename GfxFamily, typename Dispatcher>
+bool DrmDirectSubmission<GfxFamily, Dispatcher>::isCompleted(uint32_t ringBufferIndex) {
+    auto taskCount = this->ringBuffers[ringBufferIndex].completionFence;
+    return taskCount == 0 || *this->tagAddress >= static_cast<uint32_t>(taskCount);
+}
+
 template <typename GfxFamily, typename Dispatcher>
 uint64_t DrmDirectSubmission<GfxFamily, Dispatcher>::updateTagValue() {
     this->currentTagData.tagValue++;
-    this->completionRingBuffers[this->currentRingBuffer] = this->currentTagData.tagValue;
+    this->ringBuffers[this->currentRingBuffer].completionFence = this->currentTagData.tagValue;
     return 0ull;
 }
 
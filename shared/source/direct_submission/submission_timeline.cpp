@@ -0,0 +1,202 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/direct_submission/submission_timeline.h"
+
+#include "shared/source/os_interface/os_context.h"
+
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <set>
+
+namespace NEO {
+
+SubmissionTimeline SubmissionTimeline::instance;
+thread_local SubmissionTimeline::ThreadBufferHolder SubmissionTimeline::threadBuffer;
+
+void SubmissionTimelineThreadBuffer::push(const SubmissionTimelineRecord &record) {
+    auto position = recordCount.load(std::memory_order_relaxed);
+    auto &slot = slots[position % capacity];
+    slot.sequence.store(2 * position + 1, std::memory_order_relaxed);
+    //reader that observes any of new values also observes odd sequence
+    slot.start.store(record.start, std::memory_order_release);
+    slot.duration.store(record.duration, std::memory_order_release);
+    slot.value.store(record.value, std::memory_order_release);
+    slot.engineId.store(record.engineId, std::memory_order_release);
+    slot.event.store(static_cast<uint32_t>(record.event), std::memory_order_release);
+    slot.sequence.store(2 * (position + 1), std::memory_order_release);
+    recordCount.store(position + 1, std::memory_order_release);
+}
+
+bool SubmissionTimelineThreadBuffer::read(uint64_t position, SubmissionTimelineRecord &record) const {
+    auto &slot = slots[position % capacity];
+    auto sequence = 2 * (position + 1);
+    if (slot.sequence.load(std::memory_order_acquire) != sequence) {
+        return false;
+    }
+    record.start = slot.start.load(std::memory_order_acquire);
+    record.duration = slot.duration.load(std::memory_order_acquire);
+    record.value = slot.value.load(std::memory_order_acquire);
+    record.engineId = slot.engineId.load(std::memory_order_acquire);
+    record.event = static_cast<SubmissionTimelineEvent>(slot.event.load(std::memory_order_acquire));
+    //record is torn when the writer wrapped around to this slot meanwhile
+    return slot.sequence.load(std::memory_order_relaxed) == sequence;
+}
+
+void SubmissionTimelineThreadBuffer::copyRecords(std::vector<SubmissionTimelineRecord> &output) const {
+    auto count = recordCount.load(std::memory_order_acquire);
+    auto first = count > capacity ? count - capacity : 0u;
+    for (auto position = first; position < count; position++) {
+        SubmissionTimelineRecord record;
+        if (read(position, record)) {
+            output.push_back(record);
+        }
+    }
+}
+
+void SubmissionTimelineClock::capture(uint64_t gpuTimestamp, double gpuTimerResolution) {
+    gpuBase = gpuTimestamp;
+    hostBase = SubmissionTimeline::getTimestamp();
+    resolution = gpuTimerResolution;
+    captured.store(true, std::memory_order_release);
+}
+
+bool SubmissionTimelineClock::convert(uint64_t gpuTimestamp, int64_t &hostTimestamp) const {
+    if (!isCaptured() || gpuTimestamp == 0u) {
+        return false;
+    }
+    auto gpuDelta = static_cast<double>(static_cast<int64_t>(gpuTimestamp - gpuBase));
+    hostTimestamp = hostBase + static_cast<int64_t>(gpuDelta * resolution);
+    return true;
+}
+
+uint32_t SubmissionTimeline::getEngineId(const OsContext *osContext) {
+    return osContext ? osContext->getContextId() : 0u;
+}
+
+SubmissionTimeline::~SubmissionTimeline() {
+    if (!exportFileName.empty()) {
+        exportChromeTrace(exportFileName);
+    }
+}
+
+SubmissionTimelineThreadBuffer *SubmissionTimeline::getThreadBuffer() {
+    auto &holder = threadBuffer;
+    if (holder.buffer == nullptr || holder.generation != generation.load(std::memory_order_acquire)) {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (holder.buffer) {
+            holder.buffer->release();
+            holder.buffer.reset();
+        }
+        for (auto &buffer : threadBuffers) {
+            if (buffer->tryClaim()) {
+                holder.buffer = buffer;
+                break;
+            }
+        }
+        if (holder.buffer == nullptr) {
+            size_t capacity = static_cast<size_t>(std::max(DebugManager.flags.SubmissionTimelineBufferSize.get(), 1));
+            threadBuffers.push_back(std::make_shared<SubmissionTimelineThreadBuffer>(static_cast<uint32_t>(threadBuffers.size()), capacity));
+            holder.buffer = threadBuffers.back();
+        }
+        holder.generation = generation.load(std::memory_order_relaxed);
+
+        auto fileName = DebugManager.flags.SubmissionTimelineExportFile.get();
+        if (fileName != "unk") {
+            exportFileName = fileName;
+        }
+    }
+    return holder.buffer.get();
+}
+
+void SubmissionTimeline::record(SubmissionTimelineEvent event, uint32_t engineId, uint64_t value, int64_t start, int64_t duration) {
+    SubmissionTimelineRecord record;
+    record.start = start;
+    record.duration = duration;
+    record.value = value;
+    record.engineId = engineId;
+    record.event = event;
+    getThreadBuffer()->push(record);
+}
+
+void SubmissionTimeline::reset() {
+    std::lock_guard<std::mutex> lock(mutex);
+    threadBuffers.clear();
+    generation++;
+}
+
+const char *SubmissionTimeline::getEventName(SubmissionTimelineEvent event) {
+    switch (event) {
+    case SubmissionTimelineEvent::Enqueue:
+        return "enqueue";
+    case SubmissionTimelineEvent::FlushTask:
+        return "flushTask";
+    case SubmissionTimelineEvent::RingDispatch:
+        return "ringDispatch";
+    case SubmissionTimelineEvent::SemaphoreRelease:
+        return "semaphoreRelease";
+    case SubmissionTimelineEvent::TagCompletion:
+        return "tagCompletion";
+    default:
+        return "unknown";
+    }
+}
+
+void SubmissionTimeline::exportChromeTrace(std::ostream &out) const {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto streamFlags = out.flags();
+    auto streamPrecision = out.precision();
+    //chrome trace timestamps are in microseconds, keep nanosecond resolution
+    out << std::fixed << std::setprecision(3);
+
+    std::set<uint32_t> engines;
+    std::vector<SubmissionTimelineRecord> records;
+    bool firstEvent = true;
+
+    out << "{\"traceEvents\":[";
+    for (auto &buffer : threadBuffers) {
+        records.clear();
+        buffer->copyRecords(records);
+        for (auto &record : records) {
+            engines.insert(record.engineId);
+            out << (firstEvent ? "\n" : ",\n");
+            firstEvent = false;
+
+            out << "{\"name\":\"" << getEventName(record.event) << "\",\"cat\":\"submission\"";
+            if (record.duration > 0) {
+                out << ",\"ph\":\"X\",\"dur\":" << static_cast<double>(record.duration) / 1000.0;
+            } else {
+                out << ",\"ph\":\"i\",\"s\":\"t\"";
+            }
+            out << ",\"ts\":" << static_cast<double>(record.start) / 1000.0
+                << ",\"pid\":" << record.engineId
+                << ",\"tid\":" << buffer->getThreadIndex()
+                << ",\"args\":{\"value\":" << record.value << "}}";
+        }
+    }
+    for (auto engineId : engines) {
+        out << (firstEvent ? "\n" : ",\n");
+        firstEvent = false;
+        out << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":" << engineId
+            << ",\"args\":{\"name\":\"engine " << engineId << "\"}}";
+    }
+    out << "\n]}\n";
+    out.flags(streamFlags);
+    out.precision(streamPrecision);
+}
+
+bool SubmissionTimeline::exportChromeTrace(const std::string &fileName) const {
+    std::ofstream file(fileName, std::ios::trunc);
+    if (!file.good()) {
+        return false;
+    }
+    exportChromeTrace(file);
+    return true;
+}
+
+} // namespace NEO
@@ -0,0 +1,191 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/debug_settings/debug_settings_manager.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace NEO {
+class OsContext;
+
+enum class SubmissionTimelineEvent : uint32_t {
+    Enqueue,
+    FlushTask,
+    RingDispatch,
+    SemaphoreRelease,
+    TagCompletion,
+    Count
+};
+
+struct SubmissionTimelineRecord {
+    int64_t start = 0;
+    int64_t duration = 0;
+    uint64_t value = 0u;
+    uint32_t engineId = 0u;
+    SubmissionTimelineEvent event = SubmissionTimelineEvent::Count;
+};
+
+// Written only by the owning thread, read during export without locking.
+// Slot sequence is odd while the slot is being written and 2 * (position + 1) once record at position is stored in it.
+// Buffer of exited thread is released and claimed by the next new thread, so buffers are bounded by concurrent threads.
+class SubmissionTimelineThreadBuffer {
+  public:
+    SubmissionTimelineThreadBuffer(uint32_t threadIndex, size_t capacity) : slots(new Slot[capacity]), capacity(capacity), threadIndex(threadIndex) {}
+
+    void push(const SubmissionTimelineRecord &record);
+    void copyRecords(std::vector<SubmissionTimelineRecord> &output) const;
+
+    uint32_t getThreadIndex() const {
+        return threadIndex;
+    }
+
+    bool tryClaim() {
+        bool expected = false;
+        return owned.compare_exchange_strong(expected, true, std::memory_order_acq_rel);
+    }
+
+    void release() {
+        owned.store(false, std::memory_order_release);
+    }
+
+  protected:
+    struct Slot {
+        std::atomic<uint64_t> sequence{0u};
+        std::atomic<int64_t> start{0};
+        std::atomic<int64_t> duration{0};
+        std::atomic<uint64_t> value{0u};
+        std::atomic<uint32_t> engineId{0u};
+        std::atomic<uint32_t> event{0u};
+    };
+
+    bool read(uint64_t position, SubmissionTimelineRecord &record) const;
+
+    std::unique_ptr<Slot[]> slots;
+    size_t capacity = 0u;
+    std::atomic<uint64_t> recordCount{0u};
+    std::atomic<bool> owned{true};
+    uint32_t threadIndex = 0u;
+};
+
+// Maps GPU timestamps to timeline host timestamps, captured once per engine
+class SubmissionTimelineClock {
+  public:
+    bool isCaptured() const {
+        return captured.load(std::memory_order_acquire);
+    }
+
+    void capture(uint64_t gpuTimestamp, double gpuTimerResolution);
+    bool convert(uint64_t gpuTimestamp, int64_t &hostTimestamp) const;
+
+  protected:
+    uint64_t gpuBase = 0u;
+    int64_t hostBase = 0;
+    double resolution = 0.0;
+    std::atomic<bool> captured{false};
+};
+
+class SubmissionTimeline {
+  public:
+    static SubmissionTimeline &getInstance() {
+        return instance;
+    }
+
+    static bool isEnabled() {
+        return DebugManager.flags.EnableSubmissionTimeline.get();
+    }
+
+    static uint32_t getEngineId(const OsContext *osContext);
+
+    static int64_t getTimestamp() {
+        auto now = std::chrono::high_resolution_clock::now();
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(now.time_since_epoch()).count();
+    }
+
+    ~SubmissionTimeline();
+
+    void record(SubmissionTimelineEvent event, uint32_t engineId, uint64_t value, int64_t start, int64_t duration);
+
+    void exportChromeTrace(std::ostream &out) const;
+    bool exportChromeTrace(const std::string &fileName) const;
+
+    void reset();
+
+    size_t getThreadBuffersCount() const {
+        std::lock_guard<std::mutex> lock(mutex);
+        return threadBuffers.size();
+    }
+
+    static const char *getEventName(SubmissionTimelineEvent event);
+
+  protected:
+    struct ThreadBufferHolder {
+        ~ThreadBufferHolder() {
+            if (buffer) {
+                buffer->release();
+            }
+        }
+        std::shared_ptr<SubmissionTimelineThreadBuffer> buffer;
+        uint64_t generation = 0u;
+    };
+
+    SubmissionTimelineThreadBuffer *getThreadBuffer();
+
+    static SubmissionTimeline instance;
+    static thread_local ThreadBufferHolder threadBuffer;
+
+    mutable std::mutex mutex;
+    //thread keeps its buffer alive after reset drops it from the list
+    std::vector<std::shared_ptr<SubmissionTimelineThreadBuffer>> threadBuffers;
+    std::string exportFileName;
+    std::atomic<uint64_t> generation{1u};
+};
+
+namespace SubmissionTimelineRecorder {
+inline void recordInstant(SubmissionTimelineEvent event, const OsContext *osContext, uint64_t value) {
+    if (SubmissionTimeline::isEnabled()) {
+        SubmissionTimeline::getInstance().record(event, SubmissionTimeline::getEngineId(osContext), value, SubmissionTimeline::getTimestamp(), 0);
+    }
+}
+} // namespace SubmissionTimelineRecorder
+
+class SubmissionTimelineScope {
+  public:
+    SubmissionTimelineScope(SubmissionTimelineEvent event, const OsContext *osContext) : event(event) {
+        enabled = SubmissionTimeline::isEnabled();
+        if (enabled) {
+            engineId = SubmissionTimeline::getEngineId(osContext);
+            start = SubmissionTimeline::getTimestamp();
+        }
+    }
+
+    ~SubmissionTimelineScope() {
+        if (enabled) {
+            SubmissionTimeline::getInstance().record(event, engineId, value, start, SubmissionTimeline::getTimestamp() - start);
+        }
+    }
+
+    void setValue(uint64_t newValue) {
+        value = newValue;
+    }
+
+  protected:
+    int64_t start = 0;
+    uint64_t value = 0u;
+    SubmissionTimelineEvent event;
+    uint32_t engineId = 0u;
+    bool enabled = false;
+};
+
+} // namespace NEO
@@ -31,6 +31,7 @@ class WddmDirectSubmission : public DirectSubmissionHw<GfxFamily, Dispatcher> {
     bool handleResidency() override;
     void handleCompletionRingBuffer(uint64_t completionValue, MonitoredFence &fence);
     void handleSwitchRingBuffers() override;
+    bool isCompleted(uint32_t ringBufferIndex) override;
     uint64_t updateTagValue() override;
     void getTagAddressValue(TagData &tagData) override;
 
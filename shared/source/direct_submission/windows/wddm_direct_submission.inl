@@ -94,20 +94,27 @@ bool WddmDirectSubmission<GfxFamily, Dispatcher>::handleResidency() {
 template <typename GfxFamily, typename Dispatcher>
 void WddmDirectSubmission<GfxFamily, Dispatcher>::handleSwitchRingBuffers() {
     if (ringStart) {
-        if (completionRingBuffers[currentRingBuffer] != 0) {
+        if (this->ringBuffers[this->currentRingBuffer].completionFence != 0) {
             MonitoredFence &currentFence = osContextWin->getResidencyController().getMonitoredFence();
-            handleCompletionRingBuffer(completionRingBuffers[currentRingBuffer], currentFence);
+            handleCompletionRingBuffer(this->ringBuffers[this->currentRingBuffer].completionFence, currentFence);
         }
     }
 }
 
+template <typename GfxFamily, typename Dispatcher>
+bool WddmDirectSubmission<GfxFamily, Dispatcher>::isCompleted(uint32_t ringBufferIndex) {
+    MonitoredFence &currentFence = osContextWin->getResidencyController().getMonitoredFence();
+    auto lastSubmittedFence = this->ringBuffers[ringBufferIndex].completionFence;
+    return lastSubmittedFence == 0 || *currentFence.cpuAddress >= lastSubmittedFence;
+}
+
 template <typename GfxFamily, typename Dispatcher>
 uint64_t WddmDirectSubmission<GfxFamily, Dispatcher>::updateTagValue() {
     MonitoredFence &currentFence = osContextWin->getResidencyController().getMonitoredFence();
 
     currentFence.lastSubmittedFence = currentFence.currentFenceValue;
     currentFence.currentFenceValue++;
-    completionRingBuffers[currentRingBuffer] = currentFence.lastSubmittedFence;
+    this->ringBuffers[this->currentRingBuffer].completionFence = currentFence.lastSubmittedFence;
 
     return currentFence.lastSubmittedFence;
 }
@@ -0,0 +1,124 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/memory_manager/isa_pool_allocator.h"
+
+#include "shared/source/command_stream/command_stream_receiver.h"
+#include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/device/device.h"
+#include "shared/source/helpers/aligned_memory.h"
+#include "shared/source/memory_manager/graphics_allocation.h"
+#include "shared/source/memory_manager/memory_manager.h"
+#include "shared/source/os_interface/os_context.h"
+
+#include <algorithm>
+
+namespace NEO {
+
+uint64_t SharedIsaAllocation::getGpuAddressToPatch() const {
+    return graphicsAllocation->getGpuAddressToPatch() + offset;
+}
+
+IsaPoolAllocator::IsaPoolAllocator(Device &device) : device(device) {
+    enabled = DebugManager.flags.EnableSharedIsaPool.get();
+    if (DebugManager.flags.SharedIsaPoolSize.get() > 0) {
+        poolSize = alignUp(static_cast<size_t>(DebugManager.flags.SharedIsaPoolSize.get()), MemoryConstants::pageSize) + poolPaddingSize;
+    }
+}
+
+IsaPoolAllocator::~IsaPoolAllocator() {
+    for (auto &pool : pools) {
+        device.getMemoryManager()->checkGpuUsageAndDestroyGraphicsAllocations(pool.graphicsAllocation);
+    }
+}
+
+SharedIsaAllocation *IsaPoolAllocator::requestAllocation(size_t size) {
+    //kernels larger than a pool are not worth packing
+    if (false == enabled || size > poolSize - poolPaddingSize) {
+        return allocateDedicated(size);
+    }
+
+    std::lock_guard<std::mutex> lock(mtx);
+    for (auto &pool : pools) {
+        auto isaAllocation = allocateFromPool(pool, size);
+        if (isaAllocation) {
+            return isaAllocation;
+        }
+    }
+    if (false == createPool()) {
+        return nullptr;
+    }
+    return allocateFromPool(pools.back(), size);
+}
+
+void IsaPoolAllocator::freeAllocation(SharedIsaAllocation *isaAllocation) {
+    if (isaAllocation == nullptr) {
+        return;
+    }
+    auto memoryManager = device.getMemoryManager();
+    if (false == isaAllocation->isPooled()) {
+        memoryManager->checkGpuUsageAndDestroyGraphicsAllocations(isaAllocation->getGraphicsAllocation());
+        delete isaAllocation;
+        return;
+    }
+
+    auto graphicsAllocation = isaAllocation->getGraphicsAllocation();
+    //range may be reused for another kernel, so instruction cache of engines that used the pool has to be invalidated
+    for (auto &engine : memoryManager->getRegisteredEngines()) {
+        if (graphicsAllocation->isUsedByOsContext(engine.osContext->getContextId())) {
+            engine.commandStreamReceiver->registerInstructionCacheFlush();
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(mtx);
+    for (auto &pool : pools) {
+        if (pool.graphicsAllocation == graphicsAllocation) {
+            pool.heapAllocator->free(graphicsAllocation->getGpuAddress() + isaAllocation->offset, isaAllocation->reservedSize);
+            break;
+        }
+    }
+    delete isaAllocation;
+}
+
+size_t IsaPoolAllocator::getPoolsCount() const {
+    std::lock_guard<std::mutex> lock(mtx);
+    return pools.size();
+}
+
+SharedIsaAllocation *IsaPoolAllocator::allocateDedicated(size_t size) {
+    auto graphicsAllocation = device.getMemoryManager()->allocateGraphicsMemoryWithProperties(
+        {device.getRootDeviceIndex(), size, GraphicsAllocation::AllocationType::KERNEL_ISA, device.getDeviceBitfield()});
+    if (graphicsAllocation == nullptr) {
+        return nullptr;
+    }
+    return new SharedIsaAllocation(graphicsAllocation, 0u, size, size, false);
+}
+
+SharedIsaAllocation *IsaPoolAllocator::allocateFromPool(Pool &pool, size_t size) {
+    size_t reservedSize = std::max(size, static_cast<size_t>(isaAlignment));
+    auto gpuAddress = pool.heapAllocator->allocate(reservedSize);
+    if (gpuAddress == 0llu) {
+        return nullptr;
+    }
+    auto offset = static_cast<size_t>(gpuAddress - pool.graphicsAllocation->getGpuAddress());
+    return new SharedIsaAllocation(pool.graphicsAllocation, offset, size, reservedSize, true);
+}
+
+bool IsaPoolAllocator::createPool() {
+    auto graphicsAllocation = device.getMemoryManager()->allocateGraphicsMemoryWithProperties(
+        {device.getRootDeviceIndex(), poolSize, GraphicsAllocation::AllocationType::KERNEL_ISA, device.getDeviceBitfield()});
+    if (graphicsAllocation == nullptr) {
+        return false;
+    }
+    Pool pool;
+    pool.graphicsAllocation = graphicsAllocation;
+    pool.heapAllocator = std::make_unique<HeapAllocator>(graphicsAllocation->getGpuAddress(), poolSize - poolPaddingSize, isaAlignment, poolSize);
+    pools.push_back(std::move(pool));
+    return true;
+}
+
+} // namespace NEO
@@ -0,0 +1,77 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include "shared/source/helpers/constants.h"
+#include "shared/source/helpers/non_copyable_or_moveable.h"
+#include "shared/source/utilities/heap_allocator.h"
+
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace NEO {
+class Device;
+class GraphicsAllocation;
+class IsaPoolAllocator;
+
+class SharedIsaAllocation : public NonCopyableOrMovableClass {
+  public:
+    SharedIsaAllocation(GraphicsAllocation *graphicsAllocation, size_t offset, size_t size, size_t reservedSize, bool pooled)
+        : graphicsAllocation(graphicsAllocation), offset(offset), size(size), reservedSize(reservedSize), pooled(pooled) {}
+
+    GraphicsAllocation *getGraphicsAllocation() const { return graphicsAllocation; }
+    size_t getOffset() const { return offset; }
+    size_t getSize() const { return size; }
+    bool isPooled() const { return pooled; }
+    uint64_t getGpuAddressToPatch() const;
+
+  protected:
+    friend IsaPoolAllocator;
+
+    GraphicsAllocation *graphicsAllocation = nullptr;
+    size_t offset = 0u;
+    size_t size = 0u;
+    size_t reservedSize = 0u;
+    bool pooled = false;
+};
+
+class IsaPoolAllocator : public NonCopyableOrMovableClass {
+  public:
+    static constexpr size_t defaultPoolSize = 2 * MemoryConstants::megaByte;
+    //kernel start pointer is programmed with cacheline granularity
+    static constexpr size_t isaAlignment = MemoryConstants::cacheLineSize;
+    //keeps instruction prefetch past the last kernel of a pool within the pool
+    static constexpr size_t poolPaddingSize = MemoryConstants::pageSize;
+
+    IsaPoolAllocator(Device &device);
+    ~IsaPoolAllocator();
+
+    SharedIsaAllocation *requestAllocation(size_t size);
+    void freeAllocation(SharedIsaAllocation *isaAllocation);
+
+    size_t getPoolSize() const { return poolSize; }
+    size_t getPoolsCount() const;
+
+  protected:
+    struct Pool {
+        GraphicsAllocation *graphicsAllocation = nullptr;
+        std::unique_ptr<HeapAllocator> heapAllocator;
+    };
+
+    SharedIsaAllocation *allocateDedicated(size_t size);
+    SharedIsaAllocation *allocateFromPool(Pool &pool, size_t size);
+    bool createPool();
+
+    Device &device;
+    bool enabled = true;
+    size_t poolSize = defaultPoolSize;
+    std::vector<Pool> pools;
+    mutable std::mutex mtx;
+};
+} // namespace NEO
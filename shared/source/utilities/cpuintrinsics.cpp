@@ -20,5 +20,9 @@ void pause() {
     _mm_pause();
 }
 
+void sfence() {
+    _mm_sfence();
+}
+
 } // namespace CpuIntrinsics
 } // namespace NEO
@@ -14,5 +14,7 @@ void clFlush(void const *ptr);
 
 void pause();
 
+void sfence();
+
 } // namespace CpuIntrinsics
 } // namespace NEO
@@ -67,8 +67,8 @@ HWTEST_F(DirectSubmissionTest, givenDirectSubmissionInitializedWhenRingIsStarted
     EXPECT_TRUE(ret);
     EXPECT_TRUE(directSubmission.ringStart);
 
-    EXPECT_NE(nullptr, directSubmission.ringBuffer);
-    EXPECT_NE(nullptr, directSubmission.ringBuffer2);
+    EXPECT_NE(nullptr, directSubmission.ringBuffers[0].ringBuffer);
+    EXPECT_NE(nullptr, directSubmission.ringBuffers[1].ringBuffer);
     EXPECT_NE(nullptr, directSubmission.semaphores);
 
     EXPECT_NE(0u, directSubmission.ringCommandStream.getUsed());
@@ -82,44 +82,148 @@ HWTEST_F(DirectSubmissionTest, givenDirectSubmissionInitializedWhenRingIsNotStar
     EXPECT_TRUE(ret);
     EXPECT_FALSE(directSubmission.ringStart);
 
-    EXPECT_NE(nullptr, directSubmission.ringBuffer);
-    EXPECT_NE(nullptr, directSubmission.ringBuffer2);
+    EXPECT_NE(nullptr, directSubmission.ringBuffers[0].ringBuffer);
+    EXPECT_NE(nullptr, directSubmission.ringBuffers[1].ringBuffer);
     EXPECT_NE(nullptr, directSubmission.semaphores);
 
     EXPECT_EQ(0u, directSubmission.ringCommandStream.getUsed());
 }
 
 HWTEST_F(DirectSubmissionTest, givenDirectSubmissionSwitchBuffersWhenCurrentIsPrimaryThenExpectNextSecondary) {
-    using RingBufferUse = typename MockDirectSubmissionHw<FamilyType, RenderDispatcher<FamilyType>>::RingBufferUse;
     MockDirectSubmissionHw<FamilyType, RenderDispatcher<FamilyType>> directSubmission(*pDevice,
                                                                                       *osContext.get());
 
     bool ret = directSubmission.initialize(false);
     EXPECT_TRUE(ret);
-    EXPECT_EQ(RingBufferUse::FirstBuffer, directSubmission.currentRingBuffer);
+    EXPECT_EQ(0u, directSubmission.currentRingBuffer);
 
     GraphicsAllocation *nextRing = directSubmission.switchRingBuffersAllocations();
-    EXPECT_EQ(directSubmission.ringBuffer2, nextRing);
-    EXPECT_EQ(RingBufferUse::SecondBuffer, directSubmission.currentRingBuffer);
+    EXPECT_EQ(directSubmission.ringBuffers[1].ringBuffer, nextRing);
+    EXPECT_EQ(1u, directSubmission.currentRingBuffer);
 }
 
 HWTEST_F(DirectSubmissionTest, givenDirectSubmissionSwitchBuffersWhenCurrentIsSecondaryThenExpectNextPrimary) {
-    using RingBufferUse = typename MockDirectSubmissionHw<FamilyType, RenderDispatcher<FamilyType>>::RingBufferUse;
     MockDirectSubmissionHw<FamilyType, RenderDispatcher<FamilyType>> directSubmission(*pDevice,
                                                                                       *osContext.get());
 
     bool ret = directSubmission.initialize(false);
     EXPECT_TRUE(ret);
-    EXPECT_EQ(RingBufferUse::FirstBuffer, directSubmission.currentRingBuffer);
+    EXPECT_EQ(0u, directSubmission.currentRingBuffer);
 
     GraphicsAllocation *nextRing = directSubmission.switchRingBuffersAllocations();
-    EXPECT_EQ(directSubmission.ringBuffer2, nextRing);
-    EXPECT_EQ(RingBufferUse::SecondBuffer, directSubmission.currentRingBuffer);
+    EXPECT_EQ(directSubmission.ringBuffers[1].ringBuffer, nextRing);
+    EXPECT_EQ(1u, directSubmission.currentRingBuffer);
 
     nextRing = directSubmission.switchRingBuffersAllocations();
-    EXPECT_EQ(directSubmission.ringBuffer, nextRing);
-    EXPECT_EQ(RingBufferUse::FirstBuffer, directSubmission.currentRingBuffer);
+    EXPECT_EQ(directSubmission.ringBuffers[0].ringBuffer, nextRing);
+    EXPECT_EQ(0u, directSubmission.currentRingBuffer);
 }
+HWTEST_F(DirectSubmissionTest, givenDebugFlagSetWhenCreatingDirectSubmissionThenMaxRingBufferCountIsOverridden) {
+    DebugManagerStateRestore restore;
+    MockDirectSubmissionHw<FamilyType, RenderDispatcher<FamilyType>> defaultDirectSubmission(*pDevice,
+                                                                                             *osContext.get());
+    EXPECT_EQ(UllsDefaults::defaultMaxRingBufferCount, defaultDirectSubmission.maxRingBufferCount);
+
+    DebugManager.flags.DirectSubmissionMaxRingBuffers.set(4);
+    MockDirectSubmissionHw<FamilyType, RenderDispatcher<FamilyType>> directSubmission(*pDevice,
+                                                                                      *osContext.get());
+    EXPECT_EQ(4u, directSubmission.maxRingBufferCount);
+
+    DebugManager.flags.DirectSubmissionMaxRingBuffers.set(1);
+    MockDirectSubmissionHw<FamilyType, RenderDispatcher<FamilyType>> minimalDirectSubmission(*pDevice,
+                                                                                             *osContext.get());
+    EXPECT_EQ(2u, minimalDirectSubmission.maxRingBufferCount);
+}
+
+HWTEST_F(DirectSubmissionTest, givenNextRingBufferNotCompletedWhenSwitchingRingBuffersThenNewRingBufferIsAllocated) {
+    MockDirectSubmissionHw<FamilyType, RenderDispatcher<FamilyType>> directSubmission(*pDevice,
+                                                                                      *osContext.get());
+
+    bool ret = directSubmission.initialize(false);
+    EXPECT_TRUE(ret);
+    EXPECT_EQ(2u, directSubmission.getRingBufferCount());
+
+    directSubmission.ringBuffers[1].completionFence = 2ull;
+    directSubmission.completedFenceValue = 1ull;
+
+    GraphicsAllocation *nextRing = directSubmission.switchRingBuffersAllocations();
+    EXPECT_EQ(3u, directSubmission.getRingBufferCount());
+    EXPECT_EQ(2u, directSubmission.currentRingBuffer);
+    EXPECT_EQ(directSubmission.ringBuffers[2].ringBuffer, nextRing);
+    EXPECT_EQ(GraphicsAllocation::AllocationType::RING_BUFFER, nextRing->getAllocationType());
+
+    auto &statistics = directSubmission.getRingBufferStatistics();
+    EXPECT_EQ(1u, statistics.switches);
+    EXPECT_EQ(1u, statistics.allocations);
+    EXPECT_EQ(0u, statistics.stalls);
+}
+
+HWTEST_F(DirectSubmissionTest, givenAllRingBuffersInUseAndMaxCountReachedWhenSwitchingRingBuffersThenStallIsCounted) {
+    MockDirectSubmissionHw<FamilyType, RenderDispatcher<FamilyType>> directSubmission(*pDevice,
+                                                                                      *osContext.get());
+    directSubmission.maxRingBufferCount = 2u;
+
+    bool ret = directSubmission.initialize(false);
+    EXPECT_TRUE(ret);
+
+    directSubmission.ringBuffers[1].completionFence = 2ull;
+    directSubmission.completedFenceValue = 1ull;
+
+    GraphicsAllocation *nextRing = directSubmission.switchRingBuffersAllocations();
+    EXPECT_EQ(2u, directSubmission.getRingBufferCount());
+    EXPECT_EQ(1u, directSubmission.currentRingBuffer);
+    EXPECT_EQ(directSubmission.ringBuffers[1].ringBuffer, nextRing);
+
+    auto &statistics = directSubmission.getRingBufferStatistics();
+    EXPECT_EQ(1u, statistics.switches);
+    EXPECT_EQ(0u, statistics.allocations);
+    EXPECT_EQ(1u, statistics.stalls);
+}
+
+HWTEST_F(DirectSubmissionTest, givenCompletedRingBufferWhenSwitchingRingBuffersThenRetiredRingBufferIsReusedInsteadOfNextOne) {
+    MockDirectSubmissionHw<FamilyType, RenderDispatcher<FamilyType>> directSubmission(*pDevice,
+                                                                                      *osContext.get());
+
+    bool ret = directSubmission.initialize(false);
+    EXPECT_TRUE(ret);
+
+    directSubmission.ringBuffers[1].completionFence = 2ull;
+    directSubmission.completedFenceValue = 1ull;
+    directSubmission.switchRingBuffersAllocations();
+    EXPECT_EQ(2u, directSubmission.currentRingBuffer);
+
+    directSubmission.ringBuffers[2].completionFence = 3ull;
+    directSubmission.ringBuffers[0].completionFence = 1ull;
+    GraphicsAllocation *nextRing = directSubmission.switchRingBuffersAllocations();
+    EXPECT_EQ(0u, directSubmission.currentRingBuffer);
+    EXPECT_EQ(directSubmission.ringBuffers[0].ringBuffer, nextRing);
+    EXPECT_EQ(3u, directSubmission.getRingBufferCount());
+}
+
+HWTEST_F(DirectSubmissionTest, givenMoreThanOneIdleAdditionalRingBufferWhenSwitchingRingBuffersThenSurplusRingBufferIsReleased) {
+    MockDirectSubmissionHw<FamilyType, RenderDispatcher<FamilyType>> directSubmission(*pDevice,
+                                                                                      *osContext.get());
+
+    bool ret = directSubmission.initialize(false);
+    EXPECT_TRUE(ret);
+
+    directSubmission.completedFenceValue = 0ull;
+    directSubmission.ringBuffers[0].completionFence = 1ull;
+    directSubmission.ringBuffers[1].completionFence = 1ull;
+    directSubmission.switchRingBuffersAllocations();
+    directSubmission.ringBuffers[2].completionFence = 2ull;
+    directSubmission.switchRingBuffersAllocations();
+    EXPECT_EQ(4u, directSubmission.getRingBufferCount());
+    EXPECT_EQ(3u, directSubmission.currentRingBuffer);
+
+    directSubmission.ringBuffers[3].completionFence = 3ull;
+    directSubmission.completedFenceValue = 2ull;
+    GraphicsAllocation *nextRing = directSubmission.switchRingBuffersAllocations();
+    EXPECT_EQ(directSubmission.ringBuffers[directSubmission.currentRingBuffer].ringBuffer, nextRing);
+    EXPECT_EQ(3u, directSubmission.getRingBufferCount());
+    EXPECT_EQ(1u, directSubmission.getRingBufferStatistics().releases);
+}
+
 HWTEST_F(DirectSubmissionTest, givenDirectSubmissionAllocateFailWhenRingIsStartedThenExpectRingNotStarted) {
     MockDirectSubmissionHw<FamilyType, RenderDispatcher<FamilyType>> directSubmission(*pDevice,
                                                                                       *osContext.get());
@@ -653,8 +757,8 @@ HWTEST_F(DirectSubmissionTest, whenDirectSubmissionInitializedThenExpectCreatedA
     bool ret = directSubmission->initialize(false);
     EXPECT_TRUE(ret);
 
-    GraphicsAllocation *nulledAllocation = directSubmission->ringBuffer;
-    directSubmission->ringBuffer = nullptr;
+    GraphicsAllocation *nulledAllocation = directSubmission->ringBuffers[0].ringBuffer;
+    directSubmission->ringBuffers[0].ringBuffer = nullptr;
     directSubmission.reset(nullptr);
     memoryManager->freeGraphicsMemory(nulledAllocation);
 
@@ -664,8 +768,8 @@ HWTEST_F(DirectSubmissionTest, whenDirectSubmissionInitializedThenExpectCreatedA
     ret = directSubmission->initialize(false);
     EXPECT_TRUE(ret);
 
-    nulledAllocation = directSubmission->ringBuffer2;
-    directSubmission->ringBuffer2 = nullptr;
+    nulledAllocation = directSubmission->ringBuffers[1].ringBuffer;
+    directSubmission->ringBuffers[1].ringBuffer = nullptr;
     directSubmission.reset(nullptr);
     memoryManager->freeGraphicsMemory(nulledAllocation);
 
@@ -823,6 +927,231 @@ HWTEST_F(DirectSubmissionDispatchBufferTest,
     EXPECT_TRUE(directSubmission.ringStart);
 }
 
+HWTEST_F(DirectSubmissionTest, givenDebugFlagsSetWhenCreatingDirectSubmissionThenCoalescingParametersAreSet) {
+    DebugManagerStateRestore restore;
+    DebugManager.flags.DirectSubmissionCoalesceDispatchCount.set(4);
+    DebugManager.flags.DirectSubmissionCoalesceLatencyBudget.set(100);
+
+    MockDirectSubmissionHw<FamilyType, RenderDispatcher<FamilyType>> directSubmission(*pDevice,
+                                                                                      *osContext.get());
+    EXPECT_EQ(4u, directSubmission.coalesceMaxDispatches);
+    EXPECT_EQ(100, directSubmission.coalesceLatencyBudget);
+    EXPECT_EQ(0u, directSubmission.coalescedDispatches);
+}
+
+HWTEST_F(DirectSubmissionTest, givenDefaultDebugFlagsWhenCreatingDirectSubmissionThenCoalescingIsDisabled) {
+    MockDirectSubmissionHw<FamilyType, RenderDispatcher<FamilyType>> directSubmission(*pDevice,
+                                                                                      *osContext.get());
+    EXPECT_EQ(0u, directSubmission.coalesceMaxDispatches);
+    EXPECT_EQ(-1, directSubmission.coalesceLatencyBudget);
+}
+
+HWTEST_F(DirectSubmissionDispatchBufferTest,
+         givenCoalescingEnabledWhenDispatchingCommandBuffersThenSemaphoreIsReleasedOnceForAllChainedBuffers) {
+    using MI_BATCH_BUFFER_START = typename FamilyType::MI_BATCH_BUFFER_START;
+    using MI_SEMAPHORE_WAIT = typename FamilyType::MI_SEMAPHORE_WAIT;
+
+    DebugManagerStateRestore restore;
+    DebugManager.flags.DirectSubmissionCoalesceDispatchCount.set(3);
+
+    FlushStampTracker flushStamp(true);
+
+    MockDirectSubmissionHw<FamilyType, RenderDispatcher<FamilyType>> directSubmission(*pDevice,
+                                                                                      *osContext.get());
+
+    bool ret = directSubmission.initialize(true);
+    EXPECT_TRUE(ret);
+    size_t sizeUsed = directSubmission.ringCommandStream.getUsed();
+    size_t workloadSize = directSubmission.getSizeDispatch() - directSubmission.getSizeSemaphoreSection();
+
+    ret = directSubmission.dispatchCommandBuffer(batchBuffer, flushStamp);
+    EXPECT_TRUE(ret);
+    ret = directSubmission.dispatchCommandBuffer(batchBuffer, flushStamp);
+    EXPECT_TRUE(ret);
+    EXPECT_EQ(2u, directSubmission.coalescedDispatches);
+    EXPECT_EQ(0u, directSubmission.semaphoreData->QueueWorkCount);
+    EXPECT_EQ(1u, directSubmission.currentQueueWorkCount);
+    EXPECT_EQ(sizeUsed + 2 * workloadSize, directSubmission.ringCommandStream.getUsed());
+
+    ret = directSubmission.dispatchCommandBuffer(batchBuffer, flushStamp);
+    EXPECT_TRUE(ret);
+    EXPECT_EQ(0u, directSubmission.coalescedDispatches);
+    EXPECT_EQ(1u, directSubmission.semaphoreData->QueueWorkCount);
+    EXPECT_EQ(2u, directSubmission.currentQueueWorkCount);
+    EXPECT_EQ(1u, directSubmission.submitCount);
+    EXPECT_EQ(4u, directSubmission.handleResidencyCount);
+    EXPECT_EQ(sizeUsed + 3 * workloadSize + directSubmission.getSizeSemaphoreSection(), directSubmission.ringCommandStream.getUsed());
+
+    HardwareParse hwParse;
+    hwParse.parseCommands<FamilyType>(directSubmission.ringCommandStream, sizeUsed);
+    EXPECT_EQ(1u, hwParse.getCommandCount<MI_SEMAPHORE_WAIT>());
+    EXPECT_LE(3u, hwParse.getCommandCount<MI_BATCH_BUFFER_START>());
+}
+
+HWTEST_F(DirectSubmissionDispatchBufferTest,
+         givenCoalescedCommandBuffersWhenFlushingCoalescedDispatchesThenSemaphoreIsReleased) {
+    DebugManagerStateRestore restore;
+    DebugManager.flags.DirectSubmissionCoalesceDispatchCount.set(8);
+
+    FlushStampTracker flushStamp(true);
+
+    MockDirectSubmissionHw<FamilyType, RenderDispatcher<FamilyType>> directSubmission(*pDevice,
+                                                                                      *osContext.get());
+
+    bool ret = directSubmission.initialize(true);
+    EXPECT_TRUE(ret);
+
+    ret = directSubmission.dispatchCommandBuffer(batchBuffer, flushStamp);
+    EXPECT_TRUE(ret);
+    EXPECT_EQ(1u, directSubmission.coalescedDispatches);
+    EXPECT_EQ(0u, directSubmission.semaphoreData->QueueWorkCount);
+
+    size_t sizeUsed = directSubmission.ringCommandStream.getUsed();
+    directSubmission.flushCoalescedDispatches();
+    EXPECT_EQ(0u, directSubmission.coalescedDispatches);
+    EXPECT_EQ(1u, directSubmission.semaphoreData->QueueWorkCount);
+    EXPECT_EQ(2u, directSubmission.currentQueueWorkCount);
+    EXPECT_EQ(sizeUsed + directSubmission.getSizeSemaphoreSection(), directSubmission.ringCommandStream.getUsed());
+
+    sizeUsed = directSubmission.ringCommandStream.getUsed();
+    directSubmission.flushCoalescedDispatches();
+    EXPECT_EQ(1u, directSubmission.semaphoreData->QueueWorkCount);
+    EXPECT_EQ(sizeUsed, directSubmission.ringCommandStream.getUsed());
+}
+
+HWTEST_F(DirectSubmissionDispatchBufferTest,
+         givenSingleCoalescedCommandBufferWhenCsrFlushesCoalescedSubmissionsThenSemaphoreIsReleasedUnderCsrOwnership) {
+    DebugManagerStateRestore restore;
+    DebugManager.flags.DirectSubmissionCoalesceDispatchCount.set(8);
+
+    FlushStampTracker flushStamp(true);
+
+    auto &csr = pDevice->getUltCommandStreamReceiver<FamilyType>();
+    auto directSubmission = new MockDirectSubmissionHw<FamilyType, RenderDispatcher<FamilyType>>(*pDevice,
+                                                                                                 *osContext.get());
+    csr.directSubmission.reset(directSubmission);
+
+    bool ret = directSubmission->initialize(true);
+    EXPECT_TRUE(ret);
+
+    ret = directSubmission->dispatchCommandBuffer(batchBuffer, flushStamp);
+    EXPECT_TRUE(ret);
+    EXPECT_EQ(1u, directSubmission->coalescedDispatches);
+    EXPECT_EQ(0u, directSubmission->semaphoreData->QueueWorkCount);
+
+    auto lockCounter = csr.recursiveLockCounter.load();
+    csr.flushCoalescedSubmissions();
+    EXPECT_EQ(lockCounter + 1, csr.recursiveLockCounter.load());
+    EXPECT_EQ(0u, directSubmission->coalescedDispatches);
+    EXPECT_EQ(1u, directSubmission->semaphoreData->QueueWorkCount);
+
+    csr.directSubmission.reset();
+}
+
+HWTEST_F(DirectSubmissionDispatchBufferTest,
+         givenNoCoalescedCommandBuffersWhenCsrFlushesCoalescedSubmissionsThenCsrOwnershipIsNotTaken) {
+    FlushStampTracker flushStamp(true);
+
+    auto &csr = pDevice->getUltCommandStreamReceiver<FamilyType>();
+    auto directSubmission = new MockDirectSubmissionHw<FamilyType, RenderDispatcher<FamilyType>>(*pDevice,
+                                                                                                 *osContext.get());
+    csr.directSubmission.reset(directSubmission);
+
+    bool ret = directSubmission->initialize(true);
+    EXPECT_TRUE(ret);
+    ret = directSubmission->dispatchCommandBuffer(batchBuffer, flushStamp);
+    EXPECT_TRUE(ret);
+    EXPECT_FALSE(directSubmission->hasCoalescedDispatches());
+
+    auto lockCounter = csr.recursiveLockCounter.load();
+    csr.flushCoalescedSubmissions();
+    EXPECT_EQ(lockCounter, csr.recursiveLockCounter.load());
+
+    csr.directSubmission.reset();
+}
+
+HWTEST_F(DirectSubmissionTest, givenNoDirectSubmissionWhenCsrFlushesCoalescedSubmissionsThenCsrOwnershipIsNotTaken) {
+    auto &csr = pDevice->getUltCommandStreamReceiver<FamilyType>();
+    auto lockCounter = csr.recursiveLockCounter.load();
+    csr.flushCoalescedSubmissions();
+    EXPECT_EQ(lockCounter, csr.recursiveLockCounter.load());
+}
+
+HWTEST_F(DirectSubmissionDispatchBufferTest,
+         givenCoalescingLatencyBudgetExceededWhenDispatchingCommandBufferThenSemaphoreIsReleasedImmediately) {
+    DebugManagerStateRestore restore;
+    DebugManager.flags.DirectSubmissionCoalesceDispatchCount.set(8);
+    DebugManager.flags.DirectSubmissionCoalesceLatencyBudget.set(0);
+
+    FlushStampTracker flushStamp(true);
+
+    MockDirectSubmissionHw<FamilyType, RenderDispatcher<FamilyType>> directSubmission(*pDevice,
+                                                                                      *osContext.get());
+
+    bool ret = directSubmission.initialize(true);
+    EXPECT_TRUE(ret);
+
+    size_t sizeUsed = directSubmission.ringCommandStream.getUsed();
+    ret = directSubmission.dispatchCommandBuffer(batchBuffer, flushStamp);
+    EXPECT_TRUE(ret);
+    EXPECT_EQ(0u, directSubmission.coalescedDispatches);
+    EXPECT_EQ(1u, directSubmission.semaphoreData->QueueWorkCount);
+    EXPECT_EQ(2u, directSubmission.currentQueueWorkCount);
+    EXPECT_EQ(sizeUsed + directSubmission.getSizeDispatch(), directSubmission.ringCommandStream.getUsed());
+}
+
+HWTEST_F(DirectSubmissionDispatchBufferTest,
+         givenCoalescingEnabledAndRingNotStartedWhenDispatchingCommandBufferThenCommandBufferIsSubmittedImmediately) {
+    DebugManagerStateRestore restore;
+    DebugManager.flags.DirectSubmissionCoalesceDispatchCount.set(8);
+
+    FlushStampTracker flushStamp(true);
+
+    MockDirectSubmissionHw<FamilyType, RenderDispatcher<FamilyType>> directSubmission(*pDevice,
+                                                                                      *osContext.get());
+
+    bool ret = directSubmission.initialize(false);
+    EXPECT_TRUE(ret);
+
+    ret = directSubmission.dispatchCommandBuffer(batchBuffer, flushStamp);
+    EXPECT_TRUE(ret);
+    EXPECT_EQ(0u, directSubmission.coalescedDispatches);
+    EXPECT_EQ(1u, directSubmission.semaphoreData->QueueWorkCount);
+    EXPECT_EQ(1u, directSubmission.submitCount);
+    EXPECT_TRUE(directSubmission.ringStart);
+}
+
+HWTEST_F(DirectSubmissionDispatchBufferTest,
+         givenCoalescedCommandBuffersWhenRingBufferIsFullThenCoalescedBuffersAreReleasedBeforeSwitch) {
+    DebugManagerStateRestore restore;
+    DebugManager.flags.DirectSubmissionCoalesceDispatchCount.set(8);
+
+    FlushStampTracker flushStamp(true);
+
+    MockDirectSubmissionHw<FamilyType, RenderDispatcher<FamilyType>> directSubmission(*pDevice,
+                                                                                      *osContext.get());
+
+    bool ret = directSubmission.initialize(true);
+    EXPECT_TRUE(ret);
+    GraphicsAllocation *oldRingAllocation = directSubmission.ringCommandStream.getGraphicsAllocation();
+
+    ret = directSubmission.dispatchCommandBuffer(batchBuffer, flushStamp);
+    EXPECT_TRUE(ret);
+    EXPECT_EQ(1u, directSubmission.coalescedDispatches);
+
+    size_t requiredSize = directSubmission.getSizeDispatch() +
+                          directSubmission.getSizeSwitchRingBufferSection() +
+                          directSubmission.getSizeEnd();
+    directSubmission.ringCommandStream.getSpace(directSubmission.ringCommandStream.getAvailableSpace() - requiredSize + 1);
+
+    ret = directSubmission.dispatchCommandBuffer(batchBuffer, flushStamp);
+    EXPECT_TRUE(ret);
+    EXPECT_NE(oldRingAllocation, directSubmission.ringCommandStream.getGraphicsAllocation());
+    EXPECT_EQ(1u, directSubmission.coalescedDispatches);
+    EXPECT_EQ(1u, directSubmission.semaphoreData->QueueWorkCount);
+    EXPECT_EQ(2u, directSubmission.currentQueueWorkCount);
+}
+
 HWTEST_F(DirectSubmissionTest, givenSuperBaseCsrWhenCheckingDirectSubmissionAvailableThenReturnFalse) {
     VariableBackup<UltHwConfig> backup(&ultHwConfig);
     ultHwConfig.csrSuperBaseCallDirectSubmissionAvailable = true;
@@ -0,0 +1,160 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/direct_submission/submission_timeline.h"
+#include "shared/test/unit_test/helpers/debug_manager_state_restore.h"
+
+#include "test.h"
+
+#include <sstream>
+#include <thread>
+
+using namespace NEO;
+
+struct SubmissionTimelineTest : public ::testing::Test {
+    void SetUp() override {
+        SubmissionTimeline::getInstance().reset();
+    }
+
+    void TearDown() override {
+        SubmissionTimeline::getInstance().reset();
+    }
+
+    std::string exportTrace() {
+        std::stringstream stream;
+        SubmissionTimeline::getInstance().exportChromeTrace(stream);
+        return stream.str();
+    }
+
+    DebugManagerStateRestore restore;
+};
+
+TEST_F(SubmissionTimelineTest, givenTimelineDisabledWhenRecordingEventsThenNothingIsExported) {
+    DebugManager.flags.EnableSubmissionTimeline.set(false);
+    {
+        SubmissionTimelineScope scope(SubmissionTimelineEvent::FlushTask, nullptr);
+        scope.setValue(1u);
+    }
+    SubmissionTimelineRecorder::recordInstant(SubmissionTimelineEvent::TagCompletion, nullptr, 1u);
+
+    EXPECT_EQ("{\"traceEvents\":[\n]}\n", exportTrace());
+}
+
+TEST_F(SubmissionTimelineTest, givenTimelineEnabledWhenRecordingEventsThenChromeTraceContainsThem) {
+    DebugManager.flags.EnableSubmissionTimeline.set(true);
+    SubmissionTimeline::getInstance().record(SubmissionTimelineEvent::FlushTask, 2u, 7u, 1000, 2500);
+    SubmissionTimelineRecorder::recordInstant(SubmissionTimelineEvent::TagCompletion, nullptr, 7u);
+
+    auto trace = exportTrace();
+    EXPECT_EQ(0u, trace.find("{\"traceEvents\":["));
+    EXPECT_NE(std::string::npos, trace.find("{\"name\":\"flushTask\",\"cat\":\"submission\",\"ph\":\"X\",\"dur\":2.500,\"ts\":1.000,\"pid\":2,\"tid\":0,\"args\":{\"value\":7}}"));
+    EXPECT_NE(std::string::npos, trace.find("{\"name\":\"tagCompletion\",\"cat\":\"submission\",\"ph\":\"i\",\"s\":\"t\""));
+    EXPECT_NE(std::string::npos, trace.find("{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":0,\"args\":{\"name\":\"engine 0\"}}"));
+    EXPECT_NE(std::string::npos, trace.find("{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":2,\"args\":{\"name\":\"engine 2\"}}"));
+}
+
+TEST_F(SubmissionTimelineTest, givenFullThreadBufferWhenRecordingEventThenOldestRecordIsOverwritten) {
+    DebugManager.flags.EnableSubmissionTimeline.set(true);
+    DebugManager.flags.SubmissionTimelineBufferSize.set(2);
+
+    SubmissionTimeline::getInstance().record(SubmissionTimelineEvent::Enqueue, 0u, 1u, 0, 0);
+    SubmissionTimeline::getInstance().record(SubmissionTimelineEvent::Enqueue, 0u, 2u, 0, 0);
+    SubmissionTimeline::getInstance().record(SubmissionTimelineEvent::Enqueue, 0u, 3u, 0, 0);
+
+    auto trace = exportTrace();
+    EXPECT_EQ(std::string::npos, trace.find("{\"value\":1}"));
+    EXPECT_NE(std::string::npos, trace.find("{\"value\":2}"));
+    EXPECT_NE(std::string::npos, trace.find("{\"value\":3}"));
+}
+
+TEST_F(SubmissionTimelineTest, givenRecordedEventsWhenTimelineIsResetThenRecordsAreDropped) {
+    DebugManager.flags.EnableSubmissionTimeline.set(true);
+    SubmissionTimeline::getInstance().record(SubmissionTimelineEvent::SemaphoreRelease, 1u, 5u, 0, 0);
+    SubmissionTimeline::getInstance().reset();
+
+    EXPECT_EQ("{\"traceEvents\":[\n]}\n", exportTrace());
+
+    SubmissionTimeline::getInstance().record(SubmissionTimelineEvent::RingDispatch, 1u, 6u, 0, 10);
+    EXPECT_NE(std::string::npos, exportTrace().find("\"name\":\"ringDispatch\""));
+}
+
+TEST_F(SubmissionTimelineTest, givenThreadBufferHeldByThreadWhenTimelineIsResetThenThreadRecordsIntoNewBuffer) {
+    DebugManager.flags.EnableSubmissionTimeline.set(true);
+    SubmissionTimeline::getInstance().record(SubmissionTimelineEvent::Enqueue, 0u, 1u, 0, 0);
+    EXPECT_EQ(1u, SubmissionTimeline::getInstance().getThreadBuffersCount());
+
+    SubmissionTimeline::getInstance().reset();
+    EXPECT_EQ(0u, SubmissionTimeline::getInstance().getThreadBuffersCount());
+
+    SubmissionTimeline::getInstance().record(SubmissionTimelineEvent::Enqueue, 0u, 2u, 0, 0);
+    EXPECT_EQ(1u, SubmissionTimeline::getInstance().getThreadBuffersCount());
+    auto trace = exportTrace();
+    EXPECT_EQ(std::string::npos, trace.find("{\"value\":1}"));
+    EXPECT_NE(std::string::npos, trace.find("{\"value\":2}"));
+}
+
+TEST_F(SubmissionTimelineTest, givenThreadExitedWhenNewThreadRecordsEventThenBufferOfExitedThreadIsReused) {
+    DebugManager.flags.EnableSubmissionTimeline.set(true);
+    std::thread firstThread([] {
+        SubmissionTimeline::getInstance().record(SubmissionTimelineEvent::Enqueue, 0u, 1u, 0, 0);
+    });
+    firstThread.join();
+    std::thread secondThread([] {
+        SubmissionTimeline::getInstance().record(SubmissionTimelineEvent::Enqueue, 0u, 2u, 0, 0);
+    });
+    secondThread.join();
+
+    EXPECT_EQ(1u, SubmissionTimeline::getInstance().getThreadBuffersCount());
+    auto trace = exportTrace();
+    EXPECT_NE(std::string::npos, trace.find("\"tid\":0,\"args\":{\"value\":1}"));
+    EXPECT_NE(std::string::npos, trace.find("\"tid\":0,\"args\":{\"value\":2}"));
+}
+
+TEST_F(SubmissionTimelineTest, givenThreadRecordingEventsWhenExportingConcurrentlyThenOnlyCompleteRecordsAreExported) {
+    DebugManager.flags.EnableSubmissionTimeline.set(true);
+    DebugManager.flags.SubmissionTimelineBufferSize.set(4);
+    std::atomic<bool> stop{false};
+    std::thread writer([&stop] {
+        for (uint64_t value = 1; !stop.load(); value++) {
+            SubmissionTimeline::getInstance().record(SubmissionTimelineEvent::Enqueue, 0u, value, static_cast<int64_t>(value), static_cast<int64_t>(value));
+        }
+    });
+    for (int i = 0; i < 100; i++) {
+        auto trace = exportTrace();
+        for (auto position = trace.find("\"dur\":"); position != std::string::npos; position = trace.find("\"dur\":", position + 1)) {
+            auto duration = trace.substr(position + 6, trace.find(',', position) - position - 6);
+            auto start = trace.substr(trace.find("\"ts\":", position) + 5);
+            EXPECT_EQ(duration, start.substr(0, start.find(',')));
+        }
+    }
+    stop = true;
+    writer.join();
+}
+
+TEST(SubmissionTimelineClockTest, givenClockCapturedWhenConvertingGpuTimestampThenTimerResolutionIsApplied) {
+    SubmissionTimelineClock clock;
+    int64_t hostTimestamp = 0;
+    EXPECT_FALSE(clock.convert(100u, hostTimestamp));
+
+    clock.capture(100u, 2.0);
+    EXPECT_TRUE(clock.isCaptured());
+    EXPECT_FALSE(clock.convert(0u, hostTimestamp));
+
+    int64_t baseTimestamp = 0;
+    EXPECT_TRUE(clock.convert(100u, baseTimestamp));
+    EXPECT_TRUE(clock.convert(150u, hostTimestamp));
+    EXPECT_EQ(100, hostTimestamp - baseTimestamp);
+}
+
+TEST(SubmissionTimelineEventNameTest, whenGettingEventNamesThenExpectedNamesAreReturned) {
+    EXPECT_STREQ("enqueue", SubmissionTimeline::getEventName(SubmissionTimelineEvent::Enqueue));
+    EXPECT_STREQ("flushTask", SubmissionTimeline::getEventName(SubmissionTimelineEvent::FlushTask));
+    EXPECT_STREQ("ringDispatch", SubmissionTimeline::getEventName(SubmissionTimelineEvent::RingDispatch));
+    EXPECT_STREQ("semaphoreRelease", SubmissionTimeline::getEventName(SubmissionTimelineEvent::SemaphoreRelease));
+    EXPECT_STREQ("tagCompletion", SubmissionTimeline::getEventName(SubmissionTimelineEvent::TagCompletion));
+    EXPECT_STREQ("unknown", SubmissionTimeline::getEventName(SubmissionTimelineEvent::Count));
+}
@@ -0,0 +1,109 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/memory_manager/isa_pool_allocator.h"
+#include "shared/test/unit_test/fixtures/device_fixture.h"
+#include "shared/test/unit_test/helpers/debug_manager_state_restore.h"
+
+#include "test.h"
+
+namespace NEO {
+
+struct IsaPoolAllocatorTest : public Test<DeviceFixture> {
+    void SetUp() override {
+        DebugManager.flags.EnableSharedIsaPool.set(true);
+        Test<DeviceFixture>::SetUp();
+    }
+
+    DebugManagerStateRestore restorer;
+};
+
+TEST_F(IsaPoolAllocatorTest, givenSmallKernelsWhenRequestingAllocationsThenTheyArePackedIntoOnePool) {
+    IsaPoolAllocator isaPoolAllocator(*pDevice);
+
+    auto isaAllocation0 = isaPoolAllocator.requestAllocation(100);
+    auto isaAllocation1 = isaPoolAllocator.requestAllocation(200);
+    ASSERT_NE(nullptr, isaAllocation0);
+    ASSERT_NE(nullptr, isaAllocation1);
+
+    EXPECT_TRUE(isaAllocation0->isPooled());
+    EXPECT_TRUE(isaAllocation1->isPooled());
+    EXPECT_EQ(isaAllocation0->getGraphicsAllocation(), isaAllocation1->getGraphicsAllocation());
+    EXPECT_EQ(GraphicsAllocation::AllocationType::KERNEL_ISA, isaAllocation0->getGraphicsAllocation()->getAllocationType());
+    EXPECT_EQ(1u, isaPoolAllocator.getPoolsCount());
+
+    EXPECT_NE(isaAllocation0->getOffset(), isaAllocation1->getOffset());
+    EXPECT_EQ(0u, isaAllocation0->getOffset() % IsaPoolAllocator::isaAlignment);
+    EXPECT_EQ(0u, isaAllocation1->getOffset() % IsaPoolAllocator::isaAlignment);
+    EXPECT_EQ(100u, isaAllocation0->getSize());
+    EXPECT_LE(isaAllocation0->getOffset() + isaAllocation0->getSize(), isaPoolAllocator.getPoolSize() - IsaPoolAllocator::poolPaddingSize);
+    EXPECT_EQ(isaAllocation0->getGraphicsAllocation()->getGpuAddressToPatch() + isaAllocation0->getOffset(), isaAllocation0->getGpuAddressToPatch());
+
+    isaPoolAllocator.freeAllocation(isaAllocation0);
+    isaPoolAllocator.freeAllocation(isaAllocation1);
+}
+
+TEST_F(IsaPoolAllocatorTest, givenFreedAllocationWhenRequestingAllocationOfSameSizeThenRangeIsReused) {
+    IsaPoolAllocator isaPoolAllocator(*pDevice);
+
+    auto isaAllocation = isaPoolAllocator.requestAllocation(MemoryConstants::kiloByte);
+    ASSERT_NE(nullptr, isaAllocation);
+    auto offset = isaAllocation->getOffset();
+    isaPoolAllocator.freeAllocation(isaAllocation);
+
+    isaAllocation = isaPoolAllocator.requestAllocation(MemoryConstants::kiloByte);
+    ASSERT_NE(nullptr, isaAllocation);
+    EXPECT_EQ(offset, isaAllocation->getOffset());
+    EXPECT_EQ(1u, isaPoolAllocator.getPoolsCount());
+    isaPoolAllocator.freeAllocation(isaAllocation);
+}
+
+TEST_F(IsaPoolAllocatorTest, givenFullPoolWhenRequestingAllocationThenNewPoolIsCreated) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.SharedIsaPoolSize.set(static_cast<int32_t>(2 * MemoryConstants::kiloByte));
+    IsaPoolAllocator isaPoolAllocator(*pDevice);
+
+    auto isaAllocation0 = isaPoolAllocator.requestAllocation(2 * MemoryConstants::kiloByte);
+    auto isaAllocation1 = isaPoolAllocator.requestAllocation(MemoryConstants::kiloByte);
+    ASSERT_NE(nullptr, isaAllocation0);
+    ASSERT_NE(nullptr, isaAllocation1);
+
+    EXPECT_NE(isaAllocation0->getGraphicsAllocation(), isaAllocation1->getGraphicsAllocation());
+    EXPECT_EQ(2u, isaPoolAllocator.getPoolsCount());
+
+    isaPoolAllocator.freeAllocation(isaAllocation0);
+    isaPoolAllocator.freeAllocation(isaAllocation1);
+}
+
+TEST_F(IsaPoolAllocatorTest, givenKernelLargerThanPoolWhenRequestingAllocationThenDedicatedAllocationIsReturned) {
+    IsaPoolAllocator isaPoolAllocator(*pDevice);
+
+    auto isaAllocation = isaPoolAllocator.requestAllocation(isaPoolAllocator.getPoolSize() + 1);
+    ASSERT_NE(nullptr, isaAllocation);
+    EXPECT_FALSE(isaAllocation->isPooled());
+    EXPECT_EQ(0u, isaAllocation->getOffset());
+    EXPECT_EQ(0u, isaPoolAllocator.getPoolsCount());
+    isaPoolAllocator.freeAllocation(isaAllocation);
+}
+
+TEST_F(IsaPoolAllocatorTest, givenSharedIsaPoolDisabledWhenRequestingAllocationThenDedicatedAllocationIsReturned) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableSharedIsaPool.set(false);
+    IsaPoolAllocator isaPoolAllocator(*pDevice);
+
+    auto isaAllocation = isaPoolAllocator.requestAllocation(100);
+    ASSERT_NE(nullptr, isaAllocation);
+    EXPECT_FALSE(isaAllocation->isPooled());
+    EXPECT_EQ(0u, isaPoolAllocator.getPoolsCount());
+    isaPoolAllocator.freeAllocation(isaAllocation);
+}
+
+TEST_F(IsaPoolAllocatorTest, givenDeviceWhenGettingIsaPoolAllocatorThenAllocatorIsAvailable) {
+    EXPECT_NE(nullptr, pDevice->getIsaPoolAllocator());
+}
+
+} // namespace NEO
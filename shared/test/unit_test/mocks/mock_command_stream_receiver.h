@@ -77,6 +77,14 @@ class MockCommandStreamReceiver : public CommandStreamReceiver {
         downloadAllocationsCalled = true;
     }
 
+    void downloadAllocationIfPending(GraphicsAllocation &gfxAllocation) override {
+        downloadAllocationIfPendingCalled = true;
+    }
+
+    void flushCoalescedSubmissions() override {
+        flushCoalescedSubmissionsCalled++;
+    }
+
     void programHardwareContext(LinearStream &cmdStream) override {
         programHardwareContextCalled = true;
     }
@@ -94,9 +102,11 @@ class MockCommandStreamReceiver : public CommandStreamReceiver {
     std::vector<char> instructionHeapReserveredData;
     int *flushBatchedSubmissionsCallCounter = nullptr;
     uint32_t waitForCompletionWithTimeoutCalled = 0;
+    uint32_t flushCoalescedSubmissionsCalled = 0;
     uint32_t mockTagAddress = 0;
     bool multiOsContextCapable = false;
     bool downloadAllocationsCalled = false;
+    bool downloadAllocationIfPendingCalled = false;
     bool programHardwareContextCalled = false;
     bool callParentGetTagAddress = true;
 };
@@ -16,7 +16,9 @@ template <typename GfxFamily, typename Dispatcher>
 struct MockDirectSubmissionHw : public DirectSubmissionHw<GfxFamily, Dispatcher> {
     using BaseClass = DirectSubmissionHw<GfxFamily, Dispatcher>;
     using BaseClass::allocateResources;
-    using BaseClass::completionRingBuffers;
+    using BaseClass::coalescedDispatches;
+    using BaseClass::coalesceLatencyBudget;
+    using BaseClass::coalesceMaxDispatches;
     using BaseClass::cpuCachelineFlush;
     using BaseClass::currentQueueWorkCount;
     using BaseClass::currentRingBuffer;
@@ -32,6 +34,7 @@ struct MockDirectSubmissionHw : public DirectSubmissionHw<GfxFamily, Dispatcher>
     using BaseClass::dispatchSemaphoreSection;
     using BaseClass::dispatchStartSection;
     using BaseClass::dispatchSwitchRingBufferSection;
+    using BaseClass::dispatchWorkloadCommands;
     using BaseClass::dispatchWorkloadSection;
     using BaseClass::getCommandBufferPositionGpuAddress;
     using BaseClass::getDiagnosticModeSection;
@@ -45,8 +48,10 @@ struct MockDirectSubmissionHw : public DirectSubmissionHw<GfxFamily, Dispatcher>
     using BaseClass::hwInfo;
     using BaseClass::osContext;
     using BaseClass::performDiagnosticMode;
-    using BaseClass::ringBuffer;
-    using BaseClass::ringBuffer2;
+    using BaseClass::maxRingBufferCount;
+    using BaseClass::releaseIdleRingBuffers;
+    using BaseClass::ringBufferStatistics;
+    using BaseClass::ringBuffers;
     using BaseClass::ringCommandStream;
     using BaseClass::ringStart;
     using BaseClass::semaphoreData;
@@ -90,6 +95,10 @@ struct MockDirectSubmissionHw : public DirectSubmissionHw<GfxFamily, Dispatcher>
 
     void handleSwitchRingBuffers() override {}
 
+    bool isCompleted(uint32_t ringBufferIndex) override {
+        return ringBuffers[ringBufferIndex].completionFence <= completedFenceValue;
+    }
+
     uint64_t updateTagValue() override {
         return updateTagValueReturn;
     }
@@ -112,6 +121,7 @@ struct MockDirectSubmissionHw : public DirectSubmissionHw<GfxFamily, Dispatcher>
     }
 
     uint64_t updateTagValueReturn = 1ull;
+    uint64_t completedFenceValue = 0ull;
     uint64_t tagAddressSetValue = MemoryConstants::pageSize;
     uint64_t tagValueSetValue = 1ull;
     uint64_t submitGpuAddress = 0ull;
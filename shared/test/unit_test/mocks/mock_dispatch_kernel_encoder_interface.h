@@ -51,6 +51,9 @@ struct MockDispatchKernelEncoder : public DispatchKernelEncoderI {
     uint32_t getNumThreadsPerThreadGroup() const override {
         return 1;
     }
+    uint64_t getIsaOffsetInParentAllocation() const override {
+        return isaOffsetInParentAllocation;
+    }
 
     void expectAnyMockFunctionCall();
 
@@ -64,5 +67,6 @@ struct MockDispatchKernelEncoder : public DispatchKernelEncoderI {
     uint32_t groupSizes[3];
     bool localIdGenerationByRuntime = true;
     uint32_t requiredWalkGroupOrder = 0x0u;
+    uint64_t isaOffsetInParentAllocation = 0u;
 };
 } // namespace NEO
@@ -16,7 +16,6 @@ struct MockWddmDirectSubmission : public WddmDirectSubmission<GfxFamily, Dispatc
     using BaseClass::allocateOsResources;
     using BaseClass::allocateResources;
     using BaseClass::commandBufferHeader;
-    using BaseClass::completionRingBuffers;
     using BaseClass::currentRingBuffer;
     using BaseClass::getSizeDispatch;
     using BaseClass::getSizeSemaphoreSection;
@@ -25,8 +24,9 @@ struct MockWddmDirectSubmission : public WddmDirectSubmission<GfxFamily, Dispatc
     using BaseClass::handleCompletionRingBuffer;
     using BaseClass::handleResidency;
     using BaseClass::osContextWin;
-    using BaseClass::ringBuffer;
-    using BaseClass::ringBuffer2;
+    using BaseClass::isCompleted;
+    using BaseClass::maxRingBufferCount;
+    using BaseClass::ringBuffers;
     using BaseClass::ringCommandStream;
     using BaseClass::ringFence;
     using BaseClass::ringStart;
@@ -13,6 +13,7 @@
 //std::atomic is used for sake of sanitation in MT tests
 std::atomic<uintptr_t> lastClFlushedPtr(0u);
 std::atomic<uint32_t> pauseCounter(0u);
+std::atomic<uint32_t> sfenceCounter(0u);
 
 namespace NEO {
 namespace CpuIntrinsics {
@@ -25,5 +26,9 @@ void pause() {
     pauseCounter++;
 }
 
+void sfence() {
+    sfenceCounter++;
+}
+
 } // namespace CpuIntrinsics
 } // namespace NEO